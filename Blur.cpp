@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Blur.h"
-#include "hw2/HW_blur.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { WSIZE, HSIZE, HSTEP, WSTEP, SAMPLER };
@@ -50,15 +50,15 @@ Blur::controlPanel()
 
 		// create slider
 		m_slider [i] = new QSlider(Qt::Horizontal, m_ctrlGrp);
-		m_slider [i]->setRange(1, 30);
+		m_slider [i]->setRange(1, MXBLUR-1);
 		m_slider [i]->setValue(3);
 		m_slider [i]->setSingleStep(2);
 		m_slider [i]->setTickPosition(QSlider::TicksBelow);
-		m_slider [i]->setTickInterval(5);
+		m_slider [i]->setTickInterval(25);
 
 		// create spinbox
 		m_spinBox[i] = new QSpinBox(m_ctrlGrp);
-		m_spinBox[i]->setRange(1, 30);
+		m_spinBox[i]->setRange(1, MXBLUR-1);
 		m_spinBox[i]->setValue(3);
 		m_spinBox[i]->setSingleStep(2);
 
@@ -128,58 +128,7 @@ Blur::applyFilter(ImagePtr I1, bool gpuFlag, ImagePtr I2)
 void
 Blur::blur(ImagePtr I1, int xrow, int ycol, ImagePtr I2)
 {
-	IP_copyImageHeader(I1, I2);
-	int w = I1->width();
-	int h = I1->height();
-
-	//init temp image
-	ImagePtr temp_image;
-	IP_copyImageHeader(I1, temp_image);
-
-	//error check
-	if (xrow <= 1 && ycol <= 1){
-		if (I1 != I2){
-			IP_copyImage(I1, I2);
-		}
-		return;
-	}
-	if (xrow > w && ycol > h){
-		if (I1 != I2){
-			IP_copyImage(I1, I2);
-		}
-		return;
-	}
-
-	int type;
-	ChannelPtr<uchar> p1, p2, p3;
-	for (int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-		if (xrow > 1){
-			IP_getChannel(temp_image, ch, p2, type);
-			for (int y = 0; y < h; y++){
-				HW_BLUR1D(p1, w, 1, xrow, p2);
-				p1 += w;
-				p2 += w;
-			}
-		}
-		else {
-			IP_copyImage(I1, temp_image);
-		}
-
-		IP_getChannel(temp_image, ch, p2, type);
-
-		if (ycol > 1){
-			IP_getChannel(I2, ch, p3, type);
-			for (int x = 0; x < w; x++){
-				HW_BLUR1D(p2, h, w, ycol, p3);
-				p2 += 1;
-				p3 += 1;
-			}
-		}
-		else{
-			IP_copyImage(temp_image, I2);
-		}
-
-	}
+	HW_blur(I1, xrow, ycol, I2);
 }
 
 
@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Clip.h"
-#include "hw1/HW_clip.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 
@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Contrast.h"
-#include "hw1/HW_contrast.cpp"
+#include "HW.h"
 
 void Contrast::changeBrightnessD(double val) { changeBrightnessI((int) val); }
 void Contrast::changeContrastD  (double val) { changeContrastI  ((int) val); }
@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Convolve.h"
-#include "hw2/HW_convolve.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { WSIZE, HSIZE, HSTEP, WSTEP, KERNEL, SAMPLER };
@@ -89,11 +89,16 @@ Convolve::applyFilter(ImagePtr I1, bool gpuFlag, ImagePtr I2)
 //
 // Convolve image I1 with convolution filter in kernel.
 // Output is in I2.
+// The kernel loaded by load() was analyzed once into m_plan, which
+// picks the loops to run: for 3x3 to 7x7 kernels, ones unrolled for
+// that size; the generic loops otherwise.
 //
 void
 Convolve::convolve(ImagePtr I1, ImagePtr kernel, ImagePtr I2)
 {
-	HW_convolve(I1, kernel, I2);
+	if(kernel == m_kernel)
+		HW_convolveKernel(I1, m_plan, I2);
+	else	HW_convolve(I1, kernel, I2);
 }
 
 
@@ -127,8 +132,9 @@ Convolve::load()
 	QFileInfo f(m_file);
 	m_currentDir = f.absolutePath();
 
-	// read kernel
+	// read kernel and choose how to apply it
 	m_kernel = IP_readImage(qPrintable(m_file));
+	HW_convKernelInit(m_kernel, m_plan);
 
 	// init vars
 	int w = m_kernel->width ();
@@ -11,6 +11,7 @@
 #define CONVOLVE_H
 
 #include "ImageFilter.h"
+#include "HW.h"
 
 class Convolve : public ImageFilter {
 	Q_OBJECT
@@ -36,6 +37,7 @@ private:
 	QString		m_file;
 	QString		m_currentDir;
 	ImagePtr	m_kernel;
+	HW_convKernel	m_plan;		// m_kernel analyzed for HW_convolveKernel()
 	int		m_width;	// input image width
 	int		m_height;	// input image height
 };
@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Correlation.h"
-#include "hw2/HW_correlation.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { SIZEW_T, SIZEH_T, STEPX, STEPY, STEPX_T, STEPY_T, SUM_KERNEL, SAMPLER, SAMPLER_KERNEL };
@@ -102,7 +102,10 @@ Correlation::correlation(ImagePtr I1, ImagePtr I2, int mtd, int multires, int &x
 		}
 		return;
 	}
-	float corr = HW_correlation(I1, m_cimageIn, mtd, multires, xx, yy);
+	std::vector<HW_corrMatch> match;
+	HW_correlationBatch(I1, m_ctemplate, mtd, multires, match);
+	xx = match[0].x;
+	yy = match[0].y;
 	IP_copyImageHeader(I1, I2);
 	IP_copyImage(I1, I2);
 	int w = I2->width();
@@ -176,6 +179,8 @@ Correlation::load()
 	// read input image
 	m_cimageIn = IP_readImage(qPrintable(m_file));
 	IP_castImage(m_cimageIn, BW_IMAGE, m_cimageIn);
+	m_ctemplate.resize(1);
+	HW_corrTemplateInit(m_cimageIn, m_ctemplate[0]);
 	m_width_template = m_cimageIn->width();
 	m_high_template = m_cimageIn->height(); 
 
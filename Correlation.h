@@ -11,6 +11,7 @@
 #define CORRELATION_H
 
 #include "ImageFilter.h"
+#include "HW.h"
 
 class Correlation : public ImageFilter {
 	Q_OBJECT
@@ -38,6 +39,7 @@ private:
 	QString		m_file;
 	QString		m_currentDir;
 	ImagePtr	m_cimageIn;		// input image (raw)
+	std::vector<HW_corrTemplate> m_ctemplate; // m_cimageIn prepared for matching
 	int		m_width;	// input image width
 	int		m_height;	// input image height
 	int		m_xx;
@@ -0,0 +1,356 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// FFT.cpp - Mixed-radix complex FFT and 2-D real-to-complex transforms.
+//
+// The 1-D transform is a Stockham autosort FFT: every pass reads one
+// buffer and writes the other in natural order, so there is no bit
+// reversal. Passes of radix 4, 2, 3 and 5 have hand-written butterflies;
+// any other prime factor falls back to a direct DFT of that size.
+//
+// Real 2-D transforms pack two image rows into the real and imaginary
+// parts of one complex row, so each row costs half a complex FFT, and
+// only the w/2+1 non-redundant columns of the spectrum are transformed.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "FFT.h"
+#include "ThreadPool.h"
+
+#define FFT_COLS	8		// columns gathered per column pass
+#define FFT_PI2		6.2831853071795862320E0	// 2*pi; M_PI is not standard C++
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// cmul:
+//
+// Complex product without the NaN/Inf recovery of std::complex, which
+// the compiler otherwise emits as a library call.
+//
+static inline FFT_complex
+cmul(const FFT_complex &a, const FFT_complex &b)
+{
+	return FFT_complex(a.real()*b.real() - a.imag()*b.imag(),
+			   a.real()*b.imag() + a.imag()*b.real());
+}
+
+// -i * a
+static inline FFT_complex
+mulNegI(const FFT_complex &a)
+{
+	return FFT_complex(a.imag(), -a.real());
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT_size:
+//
+// Smallest length >= n whose only prime factors are 2, 3 and 5.
+//
+int
+FFT_size(int n)
+{
+	if(n <= 1) return 1;
+	for(;; n++) {
+		int m = n;
+		while(m % 2 == 0) m /= 2;
+		while(m % 3 == 0) m /= 3;
+		while(m % 5 == 0) m /= 5;
+		if(m == 1) return n;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT::FFT:
+//
+// Constructor. Factor n and precompute the twiddles of every pass.
+// A pass of radix r on sub-length L uses exp(-2*pi*i*j*p/L) for
+// j = 1..r-1 and p = 0..L/r-1.
+//
+FFT::FFT(int n)
+	: m_n(n)
+{
+	for(int r=4; n % r == 0; ) { m_radix.push_back(r); n /= r; }
+	for(int r=2; n > 1; r++)
+		while(n % r == 0) { m_radix.push_back(r); n /= r; }
+
+	int L = m_n;
+	for(size_t k=0; k<m_radix.size(); k++) {
+		int r = m_radix[k];
+		int m = L / r;
+		for(int p=0; p<m; p++)
+			for(int j=1; j<r; j++)
+				m_twiddle.push_back(std::polar(1., -FFT_PI2*j*p / L));
+		L = m;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// pass:
+//
+// One Stockham pass of radix r: sub-sequences of length L = r*m are
+// interleaved with stride s. For p < m and q < s the r inputs
+// x[q + s*(p + k*m)] go through an r-point DFT, are multiplied by the
+// twiddles w[p*(r-1) + j-1] and land in y[q + s*(r*p + j)].
+//
+static void
+pass(int r, int m, int s, const FFT_complex *w, const FFT_complex *x, FFT_complex *y)
+{
+	const double c3  = -0.5;			// cos(2pi/3)
+	const double s3  = 0.86602540378443864676;	// sin(2pi/3)
+	const double c51 = 0.30901699437494742410;	// cos(2pi/5)
+	const double c52 = -0.80901699437494742410;	// cos(4pi/5)
+	const double s51 = 0.95105651629515357212;	// sin(2pi/5)
+	const double s52 = 0.58778525229247312917;	// sin(4pi/5)
+	int ms = m * s;
+
+	std::vector<FFT_complex> root, a, b;
+	if(r > 5) {
+		for(int k=0; k<r; k++) root.push_back(std::polar(1., -FFT_PI2*k / r));
+		a.resize(r);
+		b.resize(r);
+	}
+
+	for(int p=0; p<m; p++, w += r-1) {
+		const FFT_complex *in  = x + s*p;
+		FFT_complex	  *out = y + s*r*p;
+		switch(r) {
+		case 2:
+			for(int q=0; q<s; q++) {
+				FFT_complex a0 = in[q], a1 = in[q + ms];
+				out[q]	   = a0 + a1;
+				out[q + s] = cmul(a0 - a1, w[0]);
+			}
+			break;
+		case 3:
+			for(int q=0; q<s; q++) {
+				FFT_complex a0 = in[q], a1 = in[q + ms], a2 = in[q + 2*ms];
+				FFT_complex t1 = a1 + a2;
+				FFT_complex t2 = a0 + c3*t1;
+				FFT_complex t3 = mulNegI(s3*(a1 - a2));
+				out[q]	     = a0 + t1;
+				out[q +   s] = cmul(t2 + t3, w[0]);
+				out[q + 2*s] = cmul(t2 - t3, w[1]);
+			}
+			break;
+		case 4:
+			for(int q=0; q<s; q++) {
+				FFT_complex a0 = in[q],	       a1 = in[q +   ms];
+				FFT_complex a2 = in[q + 2*ms], a3 = in[q + 3*ms];
+				FFT_complex t0 = a0 + a2, t1 = a0 - a2;
+				FFT_complex t2 = a1 + a3, t3 = mulNegI(a1 - a3);
+				out[q]	     = t0 + t2;
+				out[q +   s] = cmul(t1 + t3, w[0]);
+				out[q + 2*s] = cmul(t0 - t2, w[1]);
+				out[q + 3*s] = cmul(t1 - t3, w[2]);
+			}
+			break;
+		case 5:
+			for(int q=0; q<s; q++) {
+				FFT_complex a0 = in[q];
+				FFT_complex a1 = in[q +   ms], a4 = in[q + 4*ms];
+				FFT_complex a2 = in[q + 2*ms], a3 = in[q + 3*ms];
+				FFT_complex t1 = a1 + a4, t2 = a2 + a3;
+				FFT_complex d1 = a1 - a4, d2 = a2 - a3;
+				FFT_complex u1 = a0 + c51*t1 + c52*t2;
+				FFT_complex u2 = a0 + c52*t1 + c51*t2;
+				FFT_complex v1 = mulNegI(s51*d1 + s52*d2);
+				FFT_complex v2 = mulNegI(s52*d1 - s51*d2);
+				out[q]	     = a0 + t1 + t2;
+				out[q +   s] = cmul(u1 + v1, w[0]);
+				out[q + 2*s] = cmul(u2 + v2, w[1]);
+				out[q + 3*s] = cmul(u2 - v2, w[2]);
+				out[q + 4*s] = cmul(u1 - v1, w[3]);
+			}
+			break;
+		default:
+			for(int q=0; q<s; q++) {
+				for(int k=0; k<r; k++) a[k] = in[q + k*ms];
+				for(int j=0; j<r; j++) {
+					FFT_complex sum = 0;
+					for(int k=0; k<r; k++) sum += cmul(a[k], root[j*k % r]);
+					b[j] = sum;
+				}
+				out[q] = b[0];
+				for(int j=1; j<r; j++) out[q + j*s] = cmul(b[j], w[j-1]);
+			}
+			break;
+		}
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT::forward:
+//
+// Forward transform of x in place. tmp is scratch of size n.
+//
+void
+FFT::forward(FFT_complex *x, FFT_complex *tmp) const
+{
+	FFT_complex	  *a = x, *b = tmp;
+	const FFT_complex *w = m_twiddle.empty() ? 0 : &m_twiddle[0];
+	int L = m_n, s = 1;
+	for(size_t k=0; k<m_radix.size(); k++) {
+		int r = m_radix[k];
+		int m = L / r;
+		pass(r, m, s, w, a, b);
+		w += m * (r-1);
+		std::swap(a, b);
+		L  = m;
+		s *= r;
+	}
+	if(a != x) memcpy(x, a, m_n * sizeof(FFT_complex));
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT::inverse:
+//
+// Inverse transform of x in place, without the 1/n scale factor:
+// conj(FFT(conj(x))).
+//
+void
+FFT::inverse(FFT_complex *x, FFT_complex *tmp) const
+{
+	for(int i=0; i<m_n; i++) x[i] = std::conj(x[i]);
+	forward(x, tmp);
+	for(int i=0; i<m_n; i++) x[i] = std::conj(x[i]);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT2D::FFT2D:
+//
+// Constructor.
+//
+FFT2D::FFT2D(int w, int h)
+	: m_width(w), m_height(h), m_row(w), m_col(h)
+{}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT2D::forward:
+//
+// Half spectrum of the sw x sh image src, zero-padded to w x h.
+// Rows y and y+1 are transformed together as z = a + i*b, and split
+// with A[k] = (Z[k] + Z*[w-k])/2 and B[k] = (Z[k] - Z*[w-k])/2i.
+//
+void
+FFT2D::forward(const float *src, int sw, int sh, int ss, FFT_complex *dst) const
+{
+	int w  = m_width;
+	int h  = m_height;
+	int cw = spectrumWidth();
+	const FFT *row = &m_row;
+
+	ThreadPool::instance().parallel_for(0, (h+1)/2, 8, [=](int lo, int hi) {
+		std::vector<FFT_complex> z(w), tmp(w);
+		for(int y=2*lo; y<2*hi; y+=2) {
+			FFT_complex *A = dst +  y   *cw;
+			FFT_complex *B = dst + (y+1)*cw;
+			bool	     two = (y+1 < h);
+			if(y >= sh) {
+				std::fill(A, A + cw, FFT_complex(0));
+				if(two) std::fill(B, B + cw, FFT_complex(0));
+				continue;
+			}
+			const float *a = src + y*ss;
+			const float *b = (y+1 < sh) ? a + ss : 0;
+			for(int x=0; x<sw; x++) z[x] = FFT_complex(a[x], b ? b[x] : 0.f);
+			for(int x=sw; x<w; x++) z[x] = 0;
+			row->forward(&z[0], &tmp[0]);
+			for(int k=0; k<cw; k++) {
+				FFT_complex zk = z[k];
+				FFT_complex zn = std::conj(z[k ? w-k : 0]);
+				A[k] = (zk + zn) * 0.5;
+				if(two) B[k] = mulNegI(zk - zn) * 0.5;
+			}
+		}
+	});
+	columns(dst, false);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT2D::inverse:
+//
+// Inverse of forward(): columns first, then each pair of half-spectrum
+// rows A, B is extended by Hermitian symmetry into z = A + i*B, whose
+// inverse transform holds row y in its real part and row y+1 in its
+// imaginary part.
+//
+void
+FFT2D::inverse(FFT_complex *src, double *dst) const
+{
+	int w  = m_width;
+	int h  = m_height;
+	int cw = spectrumWidth();
+	const FFT *row = &m_row;
+
+	columns(src, true);
+	ThreadPool::instance().parallel_for(0, (h+1)/2, 8, [=](int lo, int hi) {
+		std::vector<FFT_complex> z(w), tmp(w);
+		for(int y=2*lo; y<2*hi; y+=2) {
+			const FFT_complex *A = src + y*cw;
+			const FFT_complex *B = (y+1 < h) ? A + cw : 0;
+			for(int k=0; k<w; k++) {
+				bool	    half = (k < cw);
+				FFT_complex a = half ? A[k] : std::conj(A[w-k]);
+				FFT_complex b = !B ? 0 : half ? B[k] : std::conj(B[w-k]);
+				z[k] = FFT_complex(a.real() - b.imag(), a.imag() + b.real());
+			}
+			row->inverse(&z[0], &tmp[0]);
+			double *a = dst + y*w;
+			for(int x=0; x<w; x++) a[x] = z[x].real();
+			if(B) for(int x=0; x<w; x++) a[w+x] = z[x].imag();
+		}
+	});
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// FFT2D::columns:
+//
+// Transform the columns of the half spectrum s in place. Columns are
+// gathered FFT_COLS at a time so that every row access is contiguous.
+//
+void
+FFT2D::columns(FFT_complex *s, bool inv) const
+{
+	int h  = m_height;
+	int cw = spectrumWidth();
+	const FFT *col = &m_col;
+
+	int blocks = (cw + FFT_COLS-1) / FFT_COLS;
+	ThreadPool::instance().parallel_for(0, blocks, 1, [=](int lo, int hi) {
+		std::vector<FFT_complex> buf(FFT_COLS * h), tmp(h);
+		for(int blk=lo; blk<hi; blk++) {
+			int c0 = blk * FFT_COLS;
+			int nc = std::min(FFT_COLS, cw - c0);
+			for(int y=0; y<h; y++)
+				for(int c=0; c<nc; c++) buf[c*h + y] = s[y*cw + c0 + c];
+			for(int c=0; c<nc; c++) {
+				if(inv) col->inverse(&buf[c*h], &tmp[0]);
+				else	col->forward(&buf[c*h], &tmp[0]);
+			}
+			for(int y=0; y<h; y++)
+				for(int c=0; c<nc; c++) s[y*cw + c0 + c] = buf[c*h + y];
+		}
+	});
+}
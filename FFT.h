@@ -0,0 +1,60 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// FFT.h - Mixed-radix complex FFT and 2-D real-to-complex transforms.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <vector>
+
+typedef std::complex<double> FFT_complex;
+
+int	FFT_size(int n);		// smallest 2^a 3^b 5^c >= n
+
+// Complex transform of length n, unnormalized in both directions:
+// inverse(forward(x)) = n*x. Any n works; lengths from FFT_size() are
+// the fast ones. A plan is read-only after construction and can be
+// shared by threads.
+class FFT {
+public:
+	FFT				(int n);
+	int		size		() const { return m_n; }
+	void		forward		(FFT_complex *x, FFT_complex *tmp) const;
+	void		inverse		(FFT_complex *x, FFT_complex *tmp) const;
+
+private:
+	int		m_n;
+	std::vector<int>	 m_radix;	// factors of n, one per pass
+	std::vector<FFT_complex> m_twiddle;	// twiddles of all passes
+};
+
+// Transform of a w x h real image into its (w/2+1) x h half spectrum,
+// row-major, and back. Like FFT, inverse(forward(x)) = w*h*x. Rows and
+// columns run in parallel on the ThreadPool.
+class FFT2D {
+public:
+	FFT2D				(int w, int h);
+	int		width		() const { return m_width;  }
+	int		height		() const { return m_height; }
+	int		spectrumWidth	() const { return m_width/2 + 1; }
+
+	// src is sw x sh (<= w x h) with row stride ss; it is zero-padded
+	void		forward		(const float *src, int sw, int sh, int ss,
+					 FFT_complex *dst) const;
+	// src is destroyed; dst is w x h
+	void		inverse		(FFT_complex *src, double *dst) const;
+
+private:
+	void		columns		(FFT_complex *, bool inv) const;
+
+	int		m_width, m_height;
+	FFT		m_row, m_col;
+};
+
+#endif	// FFT_H
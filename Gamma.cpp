@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Gamma.h"
-#include "hw1/HW_gamma.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 // uniform ID
@@ -1,987 +0,0 @@
-/****************************************************************************
-** Resource object code
-**
-** Created by: The Resource Compiler for Qt version 5.5.1
-**
-** WARNING! All changes made in this file will be lost!
-*****************************************************************************/
-
-static const unsigned char qt_resource_data[] = {
-  // D:/OneDrive/csc59867/final/qip2_GPU/vshader_passthrough.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x35,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/fshader_passthrough.glsl
-  0x0,0x0,0x0,0xf5,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x31,0x35,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x9,0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,
-  0x72,0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,
-  0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,
-  0x69,0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,
-  0x64,0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,
-  0x65,0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,
-  0x6d,0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,
-  0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,
-  0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,
-  0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
-  0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,
-  0x6c,0x65,0x72,0x2c,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,
-  0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_gamma.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_threshold.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_clip.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_clip.glsl
-  0x0,0x0,0x1,0x97,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x54,0x68,
-  0x72,0x31,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,
-  0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,
-  0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x54,0x68,0x72,0x32,0x3b,
-  0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,
-  0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,
-  0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
-  0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,
-  0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,0xa,0xa,0x76,0x6f,0x69,
-  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xd,0xa,0x9,0xd,0xa,0x9,
-  0x76,0x65,0x63,0x33,0x20,0x63,0x6c,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
-  0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
-  0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,
-  0xa,0x9,0x63,0x6c,0x72,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x63,0x6c,
-  0x72,0x2c,0x20,0x75,0x5f,0x54,0x68,0x72,0x31,0x2c,0x20,0x75,0x5f,0x54,0x68,0x72,
-  0x32,0x29,0x3b,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-  0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6c,0x72,0x2c,0x20,0x31,0x2e,
-  0x30,0x29,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_quantize.glsl
-  0x0,0x0,0x3,0xaf,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,0x6d,
-  0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,
-  0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,
-  0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,
-  0x20,0x20,0x75,0x5f,0x4c,0x65,0x76,0x65,0x6c,0x73,0x3b,0x9,0x2f,0x2f,0x20,0x6c,
-  0x65,0x76,0x65,0x6c,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x44,
-  0x69,0x74,0x68,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x64,0x69,0x74,0x68,0x65,0x72,
-  0x20,0x66,0x6c,0x61,0x67,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0xa,0x68,0x69,0x67,
-  0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x61,0x6e,0x64,0x28,0x76,0x65,
-  0x63,0x32,0x20,0x63,0x6f,0x29,0xd,0xa,0x7b,0xd,0xa,0x20,0x20,0x20,0x20,0x68,
-  0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x20,0x3d,0x20,0x31,
-  0x32,0x2e,0x39,0x38,0x39,0x38,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
-  0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x20,0x3d,0x20,0x37,0x38,0x2e,
-  0x32,0x33,0x33,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
-  0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x20,0x3d,0x20,0x34,0x33,0x37,0x35,0x38,0x2e,
-  0x35,0x34,0x35,0x33,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-  0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x74,0x3d,0x20,0x64,0x6f,0x74,0x28,0x63,
-  0x6f,0x2e,0x78,0x79,0x20,0x2c,0x76,0x65,0x63,0x32,0x28,0x61,0x2c,0x62,0x29,0x29,
-  0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
-  0x61,0x74,0x20,0x73,0x6e,0x3d,0x20,0x6d,0x6f,0x64,0x28,0x64,0x74,0x2c,0x33,0x2e,
-  0x31,0x34,0x31,0x35,0x39,0x29,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
-  0x75,0x72,0x6e,0x20,0x20,0x66,0x72,0x61,0x63,0x74,0x28,0x73,0x69,0x6e,0x28,0x73,
-  0x6e,0x29,0x20,0x2a,0x20,0x63,0x29,0x3b,0xd,0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,
-  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0xa,0x9,0x68,0x69,0x67,
-  0x68,0x70,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x3d,
-  0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x75,0x5f,0x4c,0x65,0x76,0x65,0x6c,0x73,0x3b,
-  0xa,0x9,0x68,0x69,0x67,0x68,0x70,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x69,
-  0x61,0x73,0x20,0x20,0x3d,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2f,0x20,0x32,0x3b,
-  0xa,0x9,0x76,0x65,0x63,0x33,0x9,0x63,0x6c,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,
-  0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
-  0x2c,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,
-  0x62,0x3b,0xa,0x9,0x68,0x69,0x67,0x68,0x70,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,
-  0x64,0x69,0x74,0x68,0x65,0x72,0x20,0x3d,0x20,0x75,0x5f,0x44,0x69,0x74,0x68,0x65,
-  0x72,0x2a,0x62,0x69,0x61,0x73,0x2a,0x72,0x61,0x6e,0x64,0x28,0x76,0x65,0x63,0x32,
-  0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x2c,
-  0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x79,0x29,
-  0x29,0x2a,0x32,0x2e,0x30,0x3b,0xa,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
-  0x20,0x3d,0x20,0x62,0x69,0x61,0x73,0x20,0x2b,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,
-  0x2a,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x63,0x6c,0x72,0x2e,0x72,0x2b,0x64,
-  0x69,0x74,0x68,0x65,0x72,0x29,0x2a,0x75,0x5f,0x4c,0x65,0x76,0x65,0x6c,0x73,0x29,
-  0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x67,0x20,0x3d,0x20,0x62,0x69,0x61,
-  0x73,0x20,0x2b,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x6f,
-  0x72,0x28,0x28,0x63,0x6c,0x72,0x2e,0x67,0x2b,0x64,0x69,0x74,0x68,0x65,0x72,0x29,
-  0x2a,0x75,0x5f,0x4c,0x65,0x76,0x65,0x6c,0x73,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,
-  0x61,0x74,0x20,0x62,0x20,0x3d,0x20,0x62,0x69,0x61,0x73,0x20,0x2b,0x20,0x73,0x63,
-  0x61,0x6c,0x65,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x28,0x63,0x6c,0x72,
-  0x2e,0x62,0x2b,0x64,0x69,0x74,0x68,0x65,0x72,0x29,0x2a,0x75,0x5f,0x4c,0x65,0x76,
-  0x65,0x6c,0x73,0x29,0x3b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,
-  0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x2c,0x20,0x67,
-  0x2c,0x20,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_histoStretch.glsl
-  0x0,0x0,0x2,0x2d,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x54,0x68,
-  0x72,0x31,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,
-  0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,
-  0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x54,0x68,0x72,0x32,0x3b,
-  0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,
-  0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,
-  0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
-  0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,
-  0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,0xa,0xa,0x76,0x6f,0x69,
-  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xd,0xa,0x9,0xd,0xa,0x9,
-  0x76,0x65,0x63,0x33,0x20,0x63,0x6c,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
-  0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
-  0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,
-  0xa,0x9,0x63,0x6c,0x72,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x63,0x6c,
-  0x72,0x2c,0x20,0x75,0x5f,0x54,0x68,0x72,0x31,0x2c,0x20,0x75,0x5f,0x54,0x68,0x72,
-  0x32,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,
-  0x20,0x3d,0x20,0x31,0x2e,0x30,0x2f,0x28,0x75,0x5f,0x54,0x68,0x72,0x32,0x2d,0x75,
-  0x5f,0x54,0x68,0x72,0x31,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
-  0x20,0x3d,0x20,0x28,0x63,0x6c,0x72,0x2e,0x72,0x20,0x2d,0x20,0x75,0x5f,0x54,0x68,
-  0x72,0x31,0x29,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x3b,0xa,0x9,0x66,0x6c,
-  0x6f,0x61,0x74,0x20,0x67,0x20,0x3d,0x20,0x28,0x63,0x6c,0x72,0x2e,0x67,0x20,0x2d,
-  0x20,0x75,0x5f,0x54,0x68,0x72,0x31,0x29,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,
-  0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x20,0x3d,0x20,0x28,0x63,0x6c,
-  0x72,0x2e,0x62,0x20,0x2d,0x20,0x75,0x5f,0x54,0x68,0x72,0x31,0x29,0x20,0x2a,0x20,
-  0x73,0x63,0x61,0x6c,0x65,0x3b,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,
-  0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x2c,0x20,0x67,
-  0x2c,0x20,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_quantize.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_threshold.glsl
-  0x0,0x0,0x1,0xa2,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,0x6d,
-  0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,
-  0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,
-  0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,
-  0x20,0x20,0x75,0x5f,0x74,0x68,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,0x65,
-  0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0xa,0x76,0x6f,0x69,
-  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x76,0x65,0x63,0x33,
-  0x20,0x63,0x6c,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,
-  0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x5f,0x54,0x65,
-  0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,0xa,0x9,0x66,0x6c,
-  0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x73,0x74,0x65,0x70,0x28,0x75,0x5f,0x74,
-  0x68,0x72,0x2c,0x20,0x63,0x6c,0x72,0x2e,0x72,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,
-  0x61,0x74,0x20,0x67,0x20,0x3d,0x20,0x73,0x74,0x65,0x70,0x28,0x75,0x5f,0x74,0x68,
-  0x72,0x2c,0x20,0x63,0x6c,0x72,0x2e,0x67,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,
-  0x74,0x20,0x62,0x20,0x3d,0x20,0x73,0x74,0x65,0x70,0x28,0x75,0x5f,0x74,0x68,0x72,
-  0x2c,0x20,0x63,0x6c,0x72,0x2e,0x62,0x29,0x3b,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,
-  0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,
-  0x2c,0x20,0x67,0x2c,0x20,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0xa,0x7d,
-  0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_contrast.glsl
-  0x0,0x0,0x2,0x5f,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x42,0x72,
-  0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,0x72,
-  0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,
-  0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,0x20,0x20,0x75,
-  0x5f,0x43,0x6f,0x6e,0x74,0x72,0x61,0x73,0x74,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,
-  0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,
-  0x69,0x66,0x6f,0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
-  0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,
-  0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,
-  0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,
-  0x6d,0x61,0x67,0x65,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
-  0x28,0x29,0x20,0x7b,0xd,0xa,0xd,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x63,0x6c,
-  0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,
-  0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,
-  0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,0xd,0xa,0x9,0x66,0x6c,0x6f,0x61,
-  0x74,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,
-  0x75,0x5f,0x42,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x3b,0xa,0x9,0x66,
-  0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,
-  0x63,0x6c,0x72,0x2e,0x72,0x20,0x2d,0x20,0x30,0x2e,0x35,0x29,0x2a,0x75,0x5f,0x43,
-  0x6f,0x6e,0x74,0x72,0x61,0x73,0x74,0x20,0x2b,0x20,0x73,0x68,0x69,0x66,0x74,0x2c,
-  0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,
-  0x61,0x74,0x20,0x67,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x63,0x6c,
-  0x72,0x2e,0x67,0x20,0x2d,0x20,0x30,0x2e,0x35,0x29,0x2a,0x75,0x5f,0x43,0x6f,0x6e,
-  0x74,0x72,0x61,0x73,0x74,0x20,0x2b,0x20,0x73,0x68,0x69,0x66,0x74,0x2c,0x20,0x30,
-  0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,
-  0x20,0x62,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x63,0x6c,0x72,0x2e,
-  0x62,0x20,0x2d,0x20,0x30,0x2e,0x35,0x29,0x2a,0x75,0x5f,0x43,0x6f,0x6e,0x74,0x72,
-  0x61,0x73,0x74,0x20,0x2b,0x20,0x73,0x68,0x69,0x66,0x74,0x2c,0x20,0x30,0x2e,0x30,
-  0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,
-  0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x2c,0x20,
-  0x67,0x2c,0x20,0x62,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_histoStretch.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/fshader_gamma.glsl
-  0x0,0x0,0x1,0xa7,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,0x61,0x6d,
-  0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,
-  0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,
-  0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x20,0x20,
-  0x20,0x20,0x75,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x68,
-  0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0xa,0x76,
-  0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x76,0x65,
-  0x63,0x33,0x20,0x63,0x6c,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-  0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x5f,
-  0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x2e,0x72,0x67,0x62,0x3b,0xa,0x9,
-  0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x63,0x6c,
-  0x72,0x2e,0x72,0x2c,0x20,0x75,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x29,0x3b,0xa,0x9,
-  0x66,0x6c,0x6f,0x61,0x74,0x20,0x67,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x63,0x6c,
-  0x72,0x2e,0x67,0x2c,0x20,0x75,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x29,0x3b,0xa,0x9,
-  0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x20,0x3d,0x20,0x70,0x6f,0x77,0x28,0x63,0x6c,
-  0x72,0x2e,0x62,0x2c,0x20,0x75,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x29,0x3b,0xa,0x9,
-  0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
-  0x65,0x63,0x34,0x28,0x72,0x2c,0x20,0x67,0x2c,0x20,0x62,0x2c,0x20,0x31,0x2e,0x30,
-  0x29,0x3b,0xa,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw1/vshader_contrast.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/vshader_convolve.glsl
-  0x0,0x0,0x1,0x4a,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xd,0xa,0xd,0xa,0x69,
-  0x6e,0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-  0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xd,0xa,0x69,0x6e,0x20,0x20,
-  0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-  0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,
-  0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xd,0xa,0x6f,0x75,0x74,0x20,
-  0x76,0x65,0x63,0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-  0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,
-  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,
-  0x61,0x74,0x65,0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,
-  0x73,0x68,0x61,0x64,0x65,0x72,0xd,0xa,0xd,0xa,0xd,0xa,0x76,0x6f,0x69,0x64,
-  0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xd,0xa,0xd,0xa,0x20,0x20,0x20,
-  0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
-  0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
-  0x30,0x2c,0x20,0x31,0x29,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x76,0x5f,0x54,0x65,
-  0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,
-  0x6f,0x72,0x64,0x3b,0xd,0xa,0x7d,0xd,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/vshader_correlation.glsl
-  0x0,0x0,0x1,0x4a,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xd,0xa,0xd,0xa,0x69,
-  0x6e,0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
-  0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xd,0xa,0x69,0x6e,0x20,0x20,
-  0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-  0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,
-  0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xd,0xa,0x6f,0x75,0x74,0x20,
-  0x76,0x65,0x63,0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,
-  0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,
-  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,
-  0x61,0x74,0x65,0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,
-  0x73,0x68,0x61,0x64,0x65,0x72,0xd,0xa,0xd,0xa,0xd,0xa,0x76,0x6f,0x69,0x64,
-  0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xd,0xa,0xd,0xa,0x20,0x20,0x20,
-  0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
-  0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
-  0x30,0x2c,0x20,0x31,0x29,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x76,0x5f,0x54,0x65,
-  0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,
-  0x6f,0x72,0x64,0x3b,0xd,0xa,0x7d,0xd,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/vshader_sharpen.glsl
-  0x0,0x0,0x1,0x39,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0xa,0x69,0x6e,
-  0x20,0x20,0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x3b,0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
-  0x6f,0x6e,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x20,0x76,0x65,
-  0x63,0x32,0x9,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,
-  0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,
-  0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
-  0x32,0x9,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,
-  0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
-  0x20,0x74,0x6f,0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,
-  0x64,0x65,0x72,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xa,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,
-  0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x76,0x5f,0x54,
-  0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x61,0x5f,0x54,0x65,0x78,0x43,
-  0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/fshader_correlation.glsl
-  0x0,0x0,0x4,0xb8,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,
-  0x57,0x73,0x69,0x7a,0x65,0x5f,0x54,0x3b,0x9,0x2f,0x2f,0x20,0x74,0x65,0x6d,0x70,
-  0x20,0x69,0x6d,0x61,0x67,0x65,0x20,0x77,0x69,0x64,0x74,0x68,0xa,0x75,0x6e,0x69,
-  0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,0x5f,0x54,0x3b,0x9,0x2f,0x2f,0x20,0x74,
-  0x65,0x6d,0x70,0x20,0x69,0x6d,0x61,0x67,0x65,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
-  0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
-  0x6c,0x6f,0x61,0x74,0x9,0x75,0x5f,0x53,0x74,0x65,0x70,0x58,0x3b,0xa,0x75,0x6e,
-  0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
-  0x74,0x9,0x75,0x5f,0x53,0x74,0x65,0x70,0x59,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x75,
-  0x5f,0x53,0x74,0x65,0x70,0x58,0x5f,0x54,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x75,0x5f,
-  0x53,0x74,0x65,0x70,0x59,0x5f,0x54,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x20,0x20,0x75,0x5f,0x53,
-  0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2f,
-  0x2f,0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,0x75,
-  0x6e,0x69,0x66,0x6f,0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
-  0x20,0x20,0x20,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x5f,0x6b,0x65,0x72,
-  0x6e,0x65,0x6c,0x3b,0x20,0x2f,0x2f,0x20,0x74,0x65,0x6d,0x70,0x20,0x69,0x6d,0x61,
-  0x67,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,
-  0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,0x73,0x75,0x6d,0x5f,0x6b,0x65,0x72,
-  0x6e,0x65,0x6c,0x3b,0x20,0x20,0x20,0x20,0x20,0x2f,0x2f,0x20,0x73,0x75,0x6d,0x20,
-  0x6f,0x66,0x20,0x74,0x65,0x6d,0x70,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,0xa,0x2f,
-  0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,
-  0x6c,0x65,0x20,0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x69,0x64,0x67,0x65,
-  0x20,0x74,0x68,0x61,0x74,0x20,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x20,0x43,0x50,
-  0x55,0x20,0x74,0x6f,0x20,0x47,0x50,0x55,0x2c,0x20,0x79,0x6f,0x75,0x20,0x75,0x73,
-  0x65,0x20,0x69,0x74,0x20,0x74,0x6f,0x20,0x70,0x61,0x73,0x73,0x20,0x64,0x61,0x74,
-  0x61,0x20,0x66,0x72,0x6f,0x6d,0x20,0x43,0x50,0x55,0x20,0x74,0x6f,0x20,0x47,0x50,
-  0x55,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0xa,
-  0x7b,0xa,0x9,0x76,0x65,0x63,0x34,0x20,0x69,0x6d,0x61,0x67,0x65,0x20,0x3d,0x20,
-  0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,
-  0x65,0x63,0x34,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,
-  0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
-  0x6e,0x76,0x6f,0x6c,0x76,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,
-  0x30,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x63,0x20,
-  0x20,0x3d,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0xa,0x20,
-  0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x20,0x77,0x32,0x20,0x20,0x3d,0x20,0x75,0x5f,
-  0x57,0x73,0x69,0x7a,0x65,0x5f,0x54,0x20,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,
-  0x74,0x20,0x20,0x68,0x32,0x20,0x20,0x3d,0x20,0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,
-  0x5f,0x54,0x20,0x3b,0xa,0x20,0x20,0x20,0x20,0xa,0x20,0x20,0x20,0x20,0x66,0x6f,
-  0x72,0x28,0x69,0x6e,0x74,0x20,0x69,0x3d,0x30,0x3b,0x20,0x69,0x3c,0x68,0x32,0x3b,
-  0x20,0x2b,0x2b,0x69,0x29,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,
-  0x72,0x28,0x69,0x6e,0x74,0x20,0x6a,0x3d,0x30,0x3b,0x20,0x6a,0x3c,0x77,0x32,0x3b,
-  0x20,0x2b,0x2b,0x6a,0x29,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x69,0x6d,0x61,0x67,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
-  0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x76,
-  0x65,0x63,0x32,0x28,0x74,0x63,0x2e,0x78,0x20,0x2b,0x20,0x6a,0x2a,0x75,0x5f,0x53,
-  0x74,0x65,0x70,0x58,0x2c,0x20,0x74,0x63,0x2e,0x79,0x20,0x2b,0x20,0x69,0x2a,0x75,
-  0x5f,0x53,0x74,0x65,0x70,0x59,0x29,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x76,0x65,0x20,0x2b,
-  0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x2a,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
-  0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x5f,0x6b,0x65,0x72,0x6e,
-  0x65,0x6c,0x2c,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x20,0x2b,0x20,0x6a,0x2a,
-  0x75,0x5f,0x53,0x74,0x65,0x70,0x58,0x5f,0x54,0x2c,0x20,0x30,0x2e,0x30,0x20,0x2b,
-  0x20,0x69,0x2a,0x75,0x5f,0x53,0x74,0x65,0x70,0x59,0x5f,0x54,0x29,0x29,0x3b,0xa,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,
-  0x2b,0x3d,0x20,0x69,0x6d,0x61,0x67,0x65,0x2a,0x69,0x6d,0x61,0x67,0x65,0x3b,0xa,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xa,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0x9,0xa,0x20,0x20,0x20,0x20,
-  0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x28,0x63,
-  0x6f,0x6e,0x76,0x6f,0x6c,0x76,0x65,0x2f,0x73,0x71,0x72,0x74,0x28,0x73,0x75,0x6d,
-  0x29,0x2f,0x75,0x5f,0x73,0x75,0x6d,0x5f,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x29,0x3b,
-  0xa,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
-  0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,
-  0x72,0x2c,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x72,0x2c,0x20,0x72,0x65,0x73,
-  0x75,0x6c,0x74,0x2e,0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0xa,0x7d,0xa,
-  0xa,0xa,0xa,0xa,0xa,0xa,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/fshader_sharpen.glsl
-  0x0,0x0,0x2,0xbb,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x69,0x6e,0x74,0x9,0x9,0x75,0x5f,0x53,0x69,0x7a,0x65,0x3b,0x9,0x2f,
-  0x2f,0x20,0x62,0x6c,0x75,0x72,0x20,0x77,0x69,0x64,0x74,0x68,0x20,0x76,0x61,0x6c,
-  0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x9,0x9,
-  0x75,0x5f,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x75,0x5f,
-  0x53,0x74,0x65,0x70,0x58,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,
-  0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x75,0x5f,0x53,0x74,0x65,
-  0x70,0x59,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,
-  0x6c,0x65,0x72,0x32,0x44,0x9,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
-  0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x61,0x72,0x69,
-  0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,
-  0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,0x65,0xa,0xa,0xa,0x76,0x6f,0x69,
-  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xd,0xa,0x9,0xd,0xa,0x9,
-  0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x76,0x67,0x20,0x3d,
-  0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0xd,0xa,0x9,0x76,0x65,
-  0x63,0x32,0x20,0x74,0x63,0x20,0x20,0x3d,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,
-  0x6f,0x72,0x64,0x3b,0xd,0xa,0x9,0x69,0x6e,0x74,0x20,0x20,0x77,0x32,0x20,0x20,
-  0x3d,0x20,0x75,0x5f,0x53,0x69,0x7a,0x65,0x20,0x2f,0x20,0x32,0x3b,0xd,0xa,0x9,
-  0x66,0x6f,0x72,0x28,0x69,0x6e,0x74,0x20,0x69,0x3d,0x2d,0x77,0x32,0x3b,0x20,0x69,
-  0x3c,0x3d,0x77,0x32,0x3b,0x20,0x2b,0x2b,0x69,0x29,0xd,0xa,0x9,0x9,0x66,0x6f,
-  0x72,0x28,0x69,0x6e,0x74,0x20,0x6a,0x3d,0x2d,0x77,0x32,0x3b,0x20,0x6a,0x3c,0x3d,
-  0x77,0x32,0x3b,0x20,0x2b,0x2b,0x6a,0x29,0xd,0xa,0x9,0x9,0x9,0x61,0x76,0x67,
-  0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,
-  0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x63,
-  0x2e,0x78,0x20,0x2b,0x20,0x6a,0x2a,0x75,0x5f,0x53,0x74,0x65,0x70,0x58,0x2c,0x20,
-  0x74,0x63,0x2e,0x79,0x20,0x2b,0x20,0x69,0x2a,0x75,0x5f,0x53,0x74,0x65,0x70,0x59,
-  0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0xa,0x9,0x61,0x76,0x67,0x20,0x3d,0x20,0x61,
-  0x76,0x67,0x20,0x2f,0x20,0x28,0x75,0x5f,0x53,0x69,0x7a,0x65,0x2a,0x75,0x5f,0x53,
-  0x69,0x7a,0x65,0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x63,0x6c,0x72,0x20,
-  0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,
-  0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x74,0x63,0x29,0x2e,0x72,0x67,0x62,0x3b,0xa,
-  0x9,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x66,0x66,
-  0x20,0x3d,0x20,0x28,0x63,0x6c,0x72,0x20,0x2d,0x20,0x61,0x76,0x67,0x29,0x20,0x2a,
-  0x20,0x75,0x5f,0x46,0x61,0x63,0x74,0x6f,0x72,0x3b,0xa,0x9,0x63,0x6c,0x72,0x20,
-  0x2b,0x3d,0x20,0x64,0x69,0x66,0x66,0x3b,0xa,0x9,0x67,0x6c,0x5f,0x46,0x72,0x61,
-  0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6c,
-  0x72,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/fshader_convolve.glsl
-  0x0,0x0,0x2,0xf4,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xd,0xa,0xd,0xa,0x69,
-  0x6e,0x9,0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,
-  0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,
-  0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,
-  0x73,0x69,0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,
-  0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,
-  0x74,0x65,0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xd,0xa,0xd,0xa,0x75,0x6e,
-  0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,0x3b,0x9,0x2f,0x2f,0x20,0x63,0x6f,0x6e,0x76,
-  0x6f,0x6c,0x76,0x65,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x20,0x76,0x61,0x6c,0x75,
-  0x65,0xd,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x57,0x73,0x69,0x7a,0x65,0x3b,0x9,0x2f,0x2f,
-  0x20,0x63,0x6f,0x6e,0x76,0x6f,0x6c,0x76,0x65,0x20,0x77,0x69,0x64,0x74,0x68,0x20,
-  0x76,0x61,0x6c,0x75,0x65,0xd,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,
-  0x6c,0x6f,0x61,0x74,0x9,0x20,0x20,0x75,0x5f,0x57,0x53,0x74,0x65,0x70,0x3b,0xd,
-  0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x20,
-  0x20,0x75,0x5f,0x48,0x53,0x74,0x65,0x70,0x3b,0xd,0xa,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,
-  0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,
-  0x74,0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,
-  0x65,0xd,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,
-  0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x5b,0x39,0x39,
-  0x5d,0x3b,0xd,0xa,0xd,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
-  0x29,0x20,0x7b,0xd,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x61,0x76,0x67,0x20,0x3d,
-  0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0xd,0xa,0x20,0x20,0x20,
-  0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x63,0x20,0x20,0x3d,0x20,0x76,0x5f,0x54,0x65,
-  0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
-  0x20,0x20,0x77,0x32,0x20,0x20,0x3d,0x20,0x75,0x5f,0x57,0x73,0x69,0x7a,0x65,0x20,
-  0x2f,0x20,0x32,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x20,0x68,
-  0x32,0x20,0x20,0x3d,0x20,0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,0x20,0x2f,0x20,0x32,
-  0x3b,0xd,0xa,0x9,0x69,0x6e,0x74,0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,
-  0x30,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x28,0x69,0x6e,0x74,0x20,
-  0x6a,0x3d,0x2d,0x68,0x32,0x3b,0x20,0x6a,0x3c,0x3d,0x68,0x32,0x3b,0x20,0x2b,0x2b,
-  0x6a,0x29,0x7b,0xd,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
-  0x28,0x69,0x6e,0x74,0x20,0x69,0x3d,0x2d,0x77,0x32,0x3b,0x20,0x69,0x3c,0x3d,0x77,
-  0x32,0x3b,0x20,0x2b,0x2b,0x69,0x29,0x7b,0xd,0xa,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x76,0x67,0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,
-  0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,
-  0x72,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x74,0x63,0x2e,0x78,0x20,0x2b,0x20,0x69,
-  0x2a,0x75,0x5f,0x57,0x53,0x74,0x65,0x70,0x2c,0x20,0x74,0x63,0x2e,0x79,0x20,0x2b,
-  0x20,0x6a,0x2a,0x75,0x5f,0x48,0x53,0x74,0x65,0x70,0x29,0x29,0x20,0x2a,0x20,0x75,
-  0x5f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x5b,0x63,0x6f,0x75,0x6e,0x74,0x2b,0x2b,0x5d,
-  0x29,0x2e,0x72,0x67,0x62,0x3b,0xd,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x7d,0xd,0xa,0x20,0x20,0x20,0x20,0x7d,0xd,0xa,0xd,0xa,0x20,0x20,0x20,0x20,
-  0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
-  0x65,0x63,0x34,0x28,0x61,0x76,0x67,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xd,0xa,
-  0x7d,0xd,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/vshader_blur.glsl
-  0x0,0x0,0x1,0x40,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0x69,0x6e,0x20,0x20,
-  0x76,0x65,0x63,0x32,0x9,0x61,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
-  0x9,0x2f,0x2f,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x3a,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-  0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x9,
-  0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,0x20,0x61,
-  0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
-  0x65,0x3a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x9,0x76,
-  0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,
-  0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,
-  0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,
-  0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x20,0x74,0x6f,
-  0x20,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
-  0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,
-  0xa,0x20,0x20,0x20,0x20,0xa,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-  0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x61,0x5f,0x50,
-  0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,
-  0x20,0x20,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,
-  0x20,0x61,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0xa,0x7d,0xa,
-    // D:/OneDrive/csc59867/final/qip2_GPU/hw2/fshader_blur.glsl
-  0x0,0x0,0x2,0xc1,
-  0x23,
-  0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0xa,0xa,0x69,0x6e,0x9,
-  0x76,0x65,0x63,0x32,0x9,0x20,0x20,0x76,0x5f,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,
-  0x64,0x3b,0x9,0x2f,0x2f,0x20,0x76,0x61,0x72,0x79,0x69,0x6e,0x67,0x20,0x76,0x61,
-  0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x70,0x61,0x73,0x73,0x69,
-  0x6e,0x67,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,
-  0x69,0x6e,0x61,0x74,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x76,0x65,0x72,0x74,0x65,
-  0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x48,0x73,
-  0x69,0x7a,0x65,0x3b,0x9,0x2f,0x2f,0x20,0x62,0x6c,0x75,0x72,0x20,0x68,0x65,0x69,
-  0x67,0x68,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
-  0x6d,0x20,0x69,0x6e,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x5f,0x57,0x73,
-  0x69,0x7a,0x65,0x3b,0x9,0x2f,0x2f,0x20,0x62,0x6c,0x75,0x72,0x20,0x77,0x69,0x64,
-  0x74,0x68,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
-  0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,0x20,0x20,0x75,0x5f,0x57,0x53,0x74,0x65,0x70,
-  0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x9,
-  0x20,0x20,0x75,0x5f,0x48,0x53,0x74,0x65,0x70,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x53,
-  0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x9,0x2f,0x2f,0x20,0x75,0x6e,0x69,0x66,0x6f,
-  0x72,0x6d,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,
-  0x74,0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x69,0x6d,0x61,0x67,
-  0x65,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,
-  0x7b,0xd,0xa,0x9,0xd,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x61,0x76,0x67,0x20,
-  0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x3b,0xa,0x20,0x20,0x20,
-  0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x63,0x20,0x20,0x3d,0x20,0x76,0x5f,0x54,0x65,
-  0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
-  0x20,0x77,0x32,0x20,0x20,0x3d,0x20,0x75,0x5f,0x57,0x73,0x69,0x7a,0x65,0x20,0x2f,
-  0x20,0x32,0x3b,0xa,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x20,0x68,0x32,0x20,
-  0x20,0x3d,0x20,0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,0x20,0x2f,0x20,0x32,0x3b,0xa,
-  0xa,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x28,0x69,0x6e,0x74,0x20,0x69,0x3d,0x2d,
-  0x77,0x32,0x3b,0x20,0x69,0x3c,0x3d,0x77,0x32,0x3b,0x20,0x2b,0x2b,0x69,0x29,0x7b,
-  0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x28,0x69,0x6e,0x74,
-  0x20,0x6a,0x3d,0x2d,0x68,0x32,0x3b,0x20,0x6a,0x3c,0x3d,0x68,0x32,0x3b,0x20,0x2b,
-  0x2b,0x6a,0x29,0x7b,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x61,0x76,0x67,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
-  0x44,0x28,0x75,0x5f,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x76,0x65,0x63,
-  0x32,0x28,0x74,0x63,0x2e,0x78,0x20,0x2b,0x20,0x69,0x2a,0x75,0x5f,0x57,0x53,0x74,
-  0x65,0x70,0x2c,0x20,0x74,0x63,0x2e,0x79,0x20,0x2b,0x20,0x6a,0x2a,0x75,0x5f,0x48,
-  0x53,0x74,0x65,0x70,0x29,0x29,0x2e,0x72,0x67,0x62,0x3b,0xa,0x20,0x20,0x20,0x20,
-  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-  0x20,0x7d,0xa,0x20,0x20,0x20,0x20,0x7d,0xa,0xa,0x9,0x61,0x76,0x67,0x20,0x3d,
-  0x20,0x61,0x76,0x67,0x20,0x2f,0x20,0x28,0x75,0x5f,0x57,0x73,0x69,0x7a,0x65,0x20,
-  0x2a,0x20,0x75,0x5f,0x48,0x73,0x69,0x7a,0x65,0x29,0x3b,0xa,0x20,0x20,0x20,0x20,
-  0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
-  0x65,0x63,0x34,0x28,0x61,0x76,0x67,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,
-  
-  
-};
-
-static const unsigned char qt_resource_name[] = {
-  // hw2
-  0x0,0x3,
-  0x0,0x0,0x6f,0xa2,
-  0x0,0x68,
-  0x0,0x77,0x0,0x32,
-    // vshader_passthrough.glsl
-  0x0,0x18,
-  0x7,0x3d,0x91,0x5c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x70,0x0,0x61,0x0,0x73,0x0,0x73,0x0,0x74,0x0,0x68,0x0,0x72,0x0,0x6f,0x0,0x75,
-  0x0,0x67,0x0,0x68,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_passthrough.glsl
-  0x0,0x18,
-  0xf,0x3d,0x91,0x5c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x70,0x0,0x61,0x0,0x73,0x0,0x73,0x0,0x74,0x0,0x68,0x0,0x72,0x0,0x6f,0x0,0x75,
-  0x0,0x67,0x0,0x68,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // hw1
-  0x0,0x3,
-  0x0,0x0,0x6f,0xa1,
-  0x0,0x68,
-  0x0,0x77,0x0,0x31,
-    // vshader_gamma.glsl
-  0x0,0x12,
-  0x4,0xe9,0x14,0x9c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x67,0x0,0x61,0x0,0x6d,0x0,0x6d,0x0,0x61,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,
-  0x0,0x6c,
-    // vshader_threshold.glsl
-  0x0,0x16,
-  0x3,0xe2,0x48,0xdc,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x74,0x0,0x68,0x0,0x72,0x0,0x65,0x0,0x73,0x0,0x68,0x0,0x6f,0x0,0x6c,0x0,0x64,
-  0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_clip.glsl
-  0x0,0x11,
-  0x4,0x4a,0x2e,0x1c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6c,0x0,0x69,0x0,0x70,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-  
-    // fshader_clip.glsl
-  0x0,0x11,
-  0x4,0xa,0x2e,0x1c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6c,0x0,0x69,0x0,0x70,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-  
-    // fshader_quantize.glsl
-  0x0,0x15,
-  0x9,0xc,0x28,0xfc,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x71,0x0,0x75,0x0,0x61,0x0,0x6e,0x0,0x74,0x0,0x69,0x0,0x7a,0x0,0x65,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_histoStretch.glsl
-  0x0,0x19,
-  0xd,0x6c,0x40,0xfc,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x68,0x0,0x69,0x0,0x73,0x0,0x74,0x0,0x6f,0x0,0x53,0x0,0x74,0x0,0x72,0x0,0x65,
-  0x0,0x74,0x0,0x63,0x0,0x68,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_quantize.glsl
-  0x0,0x15,
-  0x9,0xc,0xa8,0xfc,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x71,0x0,0x75,0x0,0x61,0x0,0x6e,0x0,0x74,0x0,0x69,0x0,0x7a,0x0,0x65,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_threshold.glsl
-  0x0,0x16,
-  0x3,0xea,0x48,0xdc,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x74,0x0,0x68,0x0,0x72,0x0,0x65,0x0,0x73,0x0,0x68,0x0,0x6f,0x0,0x6c,0x0,0x64,
-  0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_contrast.glsl
-  0x0,0x15,
-  0x7,0xd7,0xef,0x1c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x6e,0x0,0x74,0x0,0x72,0x0,0x61,0x0,0x73,0x0,0x74,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_histoStretch.glsl
-  0x0,0x19,
-  0xd,0x6c,0x41,0xfc,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x68,0x0,0x69,0x0,0x73,0x0,0x74,0x0,0x6f,0x0,0x53,0x0,0x74,0x0,0x72,0x0,0x65,
-  0x0,0x74,0x0,0x63,0x0,0x68,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_gamma.glsl
-  0x0,0x12,
-  0x0,0xe9,0x14,0x9c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x67,0x0,0x61,0x0,0x6d,0x0,0x6d,0x0,0x61,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,
-  0x0,0x6c,
-    // vshader_contrast.glsl
-  0x0,0x15,
-  0x7,0xd7,0x6f,0x1c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x6e,0x0,0x74,0x0,0x72,0x0,0x61,0x0,0x73,0x0,0x74,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_convolve.glsl
-  0x0,0x15,
-  0x1,0xe7,0xba,0x7c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x6e,0x0,0x76,0x0,0x6f,0x0,0x6c,0x0,0x76,0x0,0x65,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_correlation.glsl
-  0x0,0x18,
-  0xc,0xc8,0x91,0x7c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x72,0x0,0x72,0x0,0x65,0x0,0x6c,0x0,0x61,0x0,0x74,0x0,0x69,
-  0x0,0x6f,0x0,0x6e,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_sharpen.glsl
-  0x0,0x14,
-  0x2,0xb7,0x7e,0x9c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x72,0x0,0x70,0x0,0x65,0x0,0x6e,0x0,0x2e,0x0,0x67,
-  0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_correlation.glsl
-  0x0,0x18,
-  0x4,0xc8,0x91,0x7c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x72,0x0,0x72,0x0,0x65,0x0,0x6c,0x0,0x61,0x0,0x74,0x0,0x69,
-  0x0,0x6f,0x0,0x6e,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_sharpen.glsl
-  0x0,0x14,
-  0x2,0xb7,0x76,0x9c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x72,0x0,0x70,0x0,0x65,0x0,0x6e,0x0,0x2e,0x0,0x67,
-  0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // fshader_convolve.glsl
-  0x0,0x15,
-  0x1,0xe7,0x3a,0x7c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x63,0x0,0x6f,0x0,0x6e,0x0,0x76,0x0,0x6f,0x0,0x6c,0x0,0x76,0x0,0x65,0x0,0x2e,
-  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-    // vshader_blur.glsl
-  0x0,0x11,
-  0x8,0x2a,0x28,0x1c,
-  0x0,0x76,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x62,0x0,0x6c,0x0,0x75,0x0,0x72,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-  
-    // fshader_blur.glsl
-  0x0,0x11,
-  0x8,0x6a,0x28,0x1c,
-  0x0,0x66,
-  0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x5f,0x0,0x62,0x0,0x6c,0x0,0x75,0x0,0x72,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
-  
-  
-};
-
-static const unsigned char qt_resource_struct[] = {
-  // :
-  0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x1,
-  // :/hw1
-  0x0,0x0,0x0,0x78,0x0,0x2,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0xd,
-  // :/hw2
-  0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x5,
-  // :/vshader_passthrough.glsl
-  0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,
-  // :/fshader_passthrough.glsl
-  0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x1,0x3d,
-  // :/hw2/fshader_convolve.glsl
-  0x0,0x0,0x3,0xb4,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x22,0x2b,
-  // :/hw2/vshader_convolve.glsl
-  0x0,0x0,0x2,0xbc,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x16,0xd7,
-  // :/hw2/fshader_sharpen.glsl
-  0x0,0x0,0x3,0x86,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x1f,0x6c,
-  // :/hw2/vshader_sharpen.glsl
-  0x0,0x0,0x3,0x22,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x19,0x73,
-  // :/hw2/fshader_correlation.glsl
-  0x0,0x0,0x3,0x50,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x1a,0xb0,
-  // :/hw2/vshader_blur.glsl
-  0x0,0x0,0x3,0xe4,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x25,0x23,
-  // :/hw2/fshader_blur.glsl
-  0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x26,0x67,
-  // :/hw2/vshader_correlation.glsl
-  0x0,0x0,0x2,0xec,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x18,0x25,
-  // :/hw1/fshader_gamma.glsl
-  0x0,0x0,0x2,0x62,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x13,0xef,
-  // :/hw1/vshader_threshold.glsl
-  0x0,0x0,0x0,0xae,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x3,0x73,
-  // :/hw1/fshader_threshold.glsl
-  0x0,0x0,0x1,0xc8,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0xe,0xa9,
-  // :/hw1/fshader_clip.glsl
-  0x0,0x0,0x1,0x8,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x5,0xed,
-  // :/hw1/vshader_clip.glsl
-  0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x4,0xb0,
-  // :/hw1/vshader_gamma.glsl
-  0x0,0x0,0x0,0x84,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x2,0x36,
-  // :/hw1/vshader_contrast.glsl
-  0x0,0x0,0x2,0x8c,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x15,0x9a,
-  // :/hw1/fshader_contrast.glsl
-  0x0,0x0,0x1,0xfa,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x10,0x4f,
-  // :/hw1/fshader_quantize.glsl
-  0x0,0x0,0x1,0x30,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x7,0x88,
-  // :/hw1/vshader_quantize.glsl
-  0x0,0x0,0x1,0x98,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0xd,0x6c,
-  // :/hw1/fshader_histoStretch.glsl
-  0x0,0x0,0x1,0x60,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0xb,0x3b,
-  // :/hw1/vshader_histoStretch.glsl
-  0x0,0x0,0x2,0x2a,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x12,0xb2,
-
-};
-
-#ifdef QT_NAMESPACE
-#  define QT_RCC_PREPEND_NAMESPACE(name) ::QT_NAMESPACE::name
-#  define QT_RCC_MANGLE_NAMESPACE0(x) x
-#  define QT_RCC_MANGLE_NAMESPACE1(a, b) a##_##b
-#  define QT_RCC_MANGLE_NAMESPACE2(a, b) QT_RCC_MANGLE_NAMESPACE1(a,b)
-#  define QT_RCC_MANGLE_NAMESPACE(name) QT_RCC_MANGLE_NAMESPACE2( \
-        QT_RCC_MANGLE_NAMESPACE0(name), QT_RCC_MANGLE_NAMESPACE0(QT_NAMESPACE))
-#else
-#   define QT_RCC_PREPEND_NAMESPACE(name) name
-#   define QT_RCC_MANGLE_NAMESPACE(name) name
-#endif
-
-#ifdef QT_NAMESPACE
-namespace QT_NAMESPACE {
-#endif
-
-bool qRegisterResourceData(int, const unsigned char *, const unsigned char *, const unsigned char *);
-
-bool qUnregisterResourceData(int, const unsigned char *, const unsigned char *, const unsigned char *);
-
-#ifdef QT_NAMESPACE
-}
-#endif
-
-int QT_RCC_MANGLE_NAMESPACE(qInitResources_qip)();
-int QT_RCC_MANGLE_NAMESPACE(qInitResources_qip)()
-{
-    QT_RCC_PREPEND_NAMESPACE(qRegisterResourceData)
-        (0x01, qt_resource_struct, qt_resource_name, qt_resource_data);
-    return 1;
-}
-
-int QT_RCC_MANGLE_NAMESPACE(qCleanupResources_qip)();
-int QT_RCC_MANGLE_NAMESPACE(qCleanupResources_qip)()
-{
-    QT_RCC_PREPEND_NAMESPACE(qUnregisterResourceData)
-       (0x01, qt_resource_struct, qt_resource_name, qt_resource_data);
-    return 1;
-}
-
-namespace {
-   struct initializer {
-       initializer() { QT_RCC_MANGLE_NAMESPACE(qInitResources_qip)(); }
-       ~initializer() { QT_RCC_MANGLE_NAMESPACE(qCleanupResources_qip)(); }
-   } dummy;
-}
@@ -0,0 +1,145 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// HW.h - Header for hw*/HW_*.cpp image processing kernels.
+//
+// The kernels only depend on the IP library. They are built into the
+// headless qipfilters library so that they can be run without the qip
+// widgets, an event loop, or a GL context.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef HW_H
+#define HW_H
+
+#include <functional>
+#include <vector>
+#include "IP.h"
+#include "FFT.h"
+#include "Tiler.h"
+using namespace IP;
+
+// stencil over tile t of a w x h uchar buffer, for HW_iterate()
+typedef std::function<void(const uchar*, int, int, const Tile&, uchar*)> HW_stencilFn;
+
+// template prepared by HW_corrTemplateInit() for HW_correlationBatch();
+// reduced levels and the spectrum are filled in on first use and kept
+struct HW_corrTemplate {
+	std::vector<ImagePtr>	 pyramid;	// [0]: first channel as float
+	double			 mean;		// average intensity
+	double			 energy;	// sum of squares (tmpl_pow)
+	std::vector<FFT_complex> spectrum;	// last template spectrum used
+	int			 spectrumKey[4];// its size, level and method
+};
+
+// taps of a convolution kernel with nonzero weight, as offsets (x,y)
+// from its center; the first even (then odd) taps stand for pairs of
+// taps (x,y) and (-x,-y) with the same (opposite) weight
+struct HW_convTaps {
+	std::vector<int>   x, y;
+	std::vector<float> w;
+	int		   even, odd;
+};
+
+// taps of a convolution kernel in 16-bit fixed point, for uchar images:
+// weight w[i]/2^shift at offset (x[i],y[i]); taps are applied in pairs,
+// one multiply-add each
+struct HW_convFixed {
+	std::vector<int>   x, y;
+	std::vector<short> w;
+	int		   shift;
+};
+
+// execution plans of HW_convKernel
+enum {
+	HW_CONV_TAPS,			// one pass over the taps
+	HW_CONV_SEPARABLE,		// sum of separable terms
+	HW_CONV_FFT,			// overlap-save FFT
+	HW_CONV_SMALL			// unrolled 3x3 to 7x7 loops
+};
+
+// kernel analyzed by HW_convKernelInit() for HW_convolveKernel()
+struct HW_convKernel {
+	int			 ww, hh;	// kernel dimensions
+	std::vector<float>	 wts;		// weights, row by row
+	int			 plan;		// HW_CONV_* plan
+	HW_convTaps		 taps;		// nonzero taps, for HW_CONV_TAPS
+	std::vector<HW_convTaps> rows, cols;	// horizontal and vertical 1-D
+						// taps of the separable terms
+	int			 fftW, fftH;	// FFT tile size, for HW_CONV_FFT
+	std::vector<FFT_complex> spectrum;	// kernel spectrum at that size
+	HW_convFixed		 fixed;		// for uchar images, in place of
+						// plan; empty if less accurate
+						// than one gray level or slower
+};
+
+// match of one template
+struct HW_corrMatch {
+	float	corr;			// correlation number
+	int	x, y;			// offset of the template in the image
+};
+
+//		hw1/HW_lut.cpp		- 8-bit lookup table (AVX-512 VBMI or scalar)
+extern void	HW_LUT8		(const uchar*, int, const uchar*, uchar*);
+extern void	HW_applyLut	(ImagePtr, const uchar*, ImagePtr);
+extern void	HW_composeLut	(const uchar*, const uchar*, uchar*);
+
+//		hw1/HW_threshold.cpp	- threshold
+extern void	HW_thresholdLut	(int, uchar*);
+extern void	HW_threshold	(ImagePtr, int, ImagePtr);
+
+//		hw1/HW_clip.cpp		- clip intensities to [t1,t2]
+extern void	HW_clipLut	(int, int, uchar*);
+extern void	HW_clip		(ImagePtr, int, int, ImagePtr);
+
+//		hw1/HW_quantize.cpp	- quantization with optional dither
+extern void	HW_quantizeLut	(int, uchar*);
+extern void	HW_quantize	(ImagePtr, int, bool, ImagePtr, unsigned int seed = 0);
+
+//		hw1/HW_gamma.cpp	- gamma correction
+extern void	HW_gammaLut	(double, uchar*);
+extern void	HW_gammaCorrect	(ImagePtr, double, ImagePtr);
+
+//		hw1/HW_contrast.cpp	- brightness/contrast enhancement
+extern void	HW_contrastLut	(double, double, uchar*);
+extern void	HW_contrast	(ImagePtr, double, double, ImagePtr);
+
+//		hw1/HW_histogram.cpp	- parallel histogram of a uchar channel
+extern void	HW_histogram	(ImagePtr, int, int*);
+
+//		hw1/HW_histoStretch.cpp	- histogram stretching
+extern void	HW_histoStretchLut(int, int, uchar*);
+extern void	HW_histoStretch	(ImagePtr, int, int, ImagePtr);
+
+//		hw1/HW_histoMatch.cpp	- histogram matching
+extern void	HW_histoMatch	(ImagePtr, ImagePtr, ImagePtr);
+
+//		hw2/HW_blur.cpp		- separable box filter
+extern void	HW_BLUR1D	(ChannelPtr<uchar>, int, int, int, ChannelPtr<uchar>);
+extern void	HW_blur		(ImagePtr, int, int, ImagePtr);
+
+//		hw2/HW_sharpen.cpp	- unsharp masking with box filter
+extern void	HW_sharpen	(ImagePtr, int, double, ImagePtr);
+
+//		hw2/HW_median.cpp	- median filter
+extern void	HW_median	(ImagePtr, int, ImagePtr, int itrs = 1);
+
+//		hw2/HW_iterate.cpp	- temporal blocking for iterated stencils
+extern void	HW_iterate	(ImagePtr, int, int, const HW_stencilFn&, ImagePtr);
+
+//		hw2/HW_convolve.cpp	- convolution with arbitrary kernel
+extern void	HW_convolve	(ImagePtr, ImagePtr, ImagePtr, int pad = REPLICATE);
+extern void	HW_convKernelInit(ImagePtr, HW_convKernel&);
+extern void	HW_convolveKernel(ImagePtr, const HW_convKernel&, ImagePtr, int pad = REPLICATE);
+
+//		hw2/HW_correlation.cpp	- template matching
+extern float	HW_correlation	(ImagePtr, ImagePtr, int, int, int&, int&);
+extern void	HW_corrTemplateInit(ImagePtr, HW_corrTemplate&);
+extern void	HW_correlationBatch(ImagePtr, std::vector<HW_corrTemplate>&, int, int,
+				    std::vector<HW_corrMatch>&);
+extern void	HW_correlationPeaks(ImagePtr, std::vector<HW_corrTemplate>&, int, int,
+				    int, int, float, std::vector<std::vector<HW_corrMatch> >&);
+
+#endif	// HW_H
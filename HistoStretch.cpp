@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "HistoStretch.h"
-#include "hw1/HW_histoStretch.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { THR1, THR2, SAMPLER };
@@ -0,0 +1,168 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// IntegralImage.cpp - Summed-area tables of an image, per channel, with
+//		       O(1) rectangle sums.
+//
+// The table is built in two parallel passes: prefix sums along every
+// row, split by rows, then running sums down every column, split by
+// ranges of columns so that each thread walks contiguous memory. Every
+// entry is computed the same way for any number of threads.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include "IntegralImage.h"
+#include "ThreadPool.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// rowSums:
+//
+// Prefix sums of the w pixels of src into table row t, and of their
+// squares into table row s unless it is NULL. Rows start with a zero.
+//
+template<class T>
+static void
+rowSums(const T *src, int w, double *t, double *s)
+{
+	double a = 0, b = 0;
+	t[0] = 0;
+	for(int x=0; x<w; x++) {
+		double v = src[x];
+		t[x+1] = a += v;
+	}
+	if(!s) return;
+	s[0] = 0;
+	for(int x=0; x<w; x++) {
+		double v = src[x];
+		s[x+1] = b += v * v;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// IntegralImage::IntegralImage:
+//
+// Constructor.
+//
+IntegralImage::IntegralImage()
+	: m_width(0), m_height(0)
+{}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// IntegralImage::build:
+//
+// Build the tables of all channels of I, and of their squared pixels
+// if squares is set. Channels that are not 8-bit are read as float.
+//
+void
+IntegralImage::build(ImagePtr I, bool squares)
+{
+	m_width  = I->width ();
+	m_height = I->height();
+
+	int n = I->maxChannel();
+	m_sum.assign(n, std::vector<double>());
+	m_sq .assign(squares ? n : 0, std::vector<double>());
+	for(int ch=0; ch<n; ch++) buildChannel(I, ch, squares);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// IntegralImage::build:
+//
+// Build the table of a single w x h float buffer p with row stride
+// ss, and of its squares if squares is set. p may be a window of a
+// larger image. No IP images are touched, so tables can be built
+// concurrently from several threads.
+//
+void
+IntegralImage::build(const float *p, int w, int h, int ss, bool squares)
+{
+	m_width  = w;
+	m_height = h;
+	m_sum.assign(1, std::vector<double>());
+	m_sq .assign(squares ? 1 : 0, std::vector<double>());
+	buildTable(0, NULL, p, ss, squares);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// IntegralImage::buildChannel:
+//
+// Build the table(s) of channel ch of I.
+//
+void
+IntegralImage::buildChannel(ImagePtr I, int ch, bool squares)
+{
+	int	  type;
+	ImagePtr  If;
+	if(I->channelType(ch) == UCHAR_TYPE) {
+		ChannelPtr<uchar> p;
+		IP_getChannel(I, ch, p, type);
+		buildTable(ch, &p[0], NULL, m_width, squares);
+	} else {
+		If = IP_allocImage(m_width, m_height, FLOATCH_TYPE);
+		IP_castChannel(I, ch, If, 0, FLOAT_TYPE);
+		ChannelPtr<float> p;
+		IP_getChannel(If, 0, p, type);
+		buildTable(ch, NULL, &p[0], m_width, squares);
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// IntegralImage::buildTable:
+//
+// Build the table(s) of channel ch from 8-bit pixels pu or float
+// pixels pf (one of them is NULL), with row stride ss.
+//
+void
+IntegralImage::buildTable(int ch, const uchar *pu, const float *pf, int ss, bool squares)
+{
+	int w = m_width;
+	int h = m_height;
+	int s = w + 1;
+
+	std::vector<double> &sum = m_sum[ch];
+	sum.assign(s * (h+1), 0.);
+	double *t  = &sum[0];
+	double *t2 = NULL;
+	if(squares) {
+		m_sq[ch].assign(s * (h+1), 0.);
+		t2 = &m_sq[ch][0];
+	}
+
+	// pass 1: prefix sums along rows, into rows 1..h of the table
+	int grain = MAX((1<<16) / MAX(w, 1), 1);
+	ThreadPool::instance().parallel_for(0, h, grain, [=](int y0, int y1) {
+		for(int y=y0; y<y1; y++) {
+			double *row  = t + (y+1)*s;
+			double *row2 = t2 ? t2 + (y+1)*s : NULL;
+			if(pu)	rowSums(pu + y*ss, w, row, row2);
+			else	rowSums(pf + y*ss, w, row, row2);
+		}
+	});
+
+	// pass 2: running sums down columns, by ranges of columns
+	grain = MAX((1<<16) / MAX(h, 1), 16);
+	ThreadPool::instance().parallel_for(1, s, grain, [=](int x0, int x1) {
+		for(int y=2; y<=h; y++) {
+			double	     *row  = t + y*s;
+			const double *prev = row - s;
+			for(int x=x0; x<x1; x++) row[x] += prev[x];
+			if(t2) {
+				row  = t2 + y*s;
+				prev = row - s;
+				for(int x=x0; x<x1; x++) row[x] += prev[x];
+			}
+		}
+	});
+}
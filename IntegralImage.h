@@ -0,0 +1,55 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// IntegralImage.h - Summed-area tables of an image, per channel, with
+//		     O(1) rectangle sums.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef INTEGRALIMAGE_H
+#define INTEGRALIMAGE_H
+
+#include <vector>
+#include "IP.h"
+using namespace IP;
+
+// Tables are (w+1) x (h+1) doubles with a zero first row and column:
+// entry (x,y) is the sum of all pixels above and left of pixel (x,y).
+// Doubles hold sums of 8-bit pixels (and their squares) exactly for
+// any image that fits in memory.
+class IntegralImage {
+public:
+	IntegralImage			();
+	void		build		(ImagePtr, bool squares = false);
+	void		build		(const float*, int w, int h, int stride,
+					 bool squares = false);
+	int		width		() const { return m_width;  }
+	int		height		() const { return m_height; }
+	int		channels	() const { return (int) m_sum.size(); }
+	bool		hasSquares	() const { return !m_sq.empty(); }
+	const double*	table		(int ch) const { return &m_sum[ch][0]; }
+	const double*	tableSq		(int ch) const { return &m_sq [ch][0]; }
+
+	// sum of pixels (or squared pixels) of channel ch in [x0,x1) x [y0,y1)
+	double		sum		(int ch, int x0, int y0, int x1, int y1) const
+				{ return rect(&m_sum[ch][0], x0, y0, x1, y1); }
+	double		sumSq		(int ch, int x0, int y0, int x1, int y1) const
+				{ return rect(&m_sq [ch][0], x0, y0, x1, y1); }
+
+private:
+	double		rect		(const double *t, int x0, int y0, int x1, int y1) const {
+				int s = m_width + 1;
+				return t[y1*s + x1] - t[y0*s + x1] - t[y1*s + x0] + t[y0*s + x0];
+			}
+	void		buildChannel	(ImagePtr, int ch, bool squares);
+	void		buildTable	(int ch, const uchar*, const float*, int stride,
+					 bool squares);
+
+	int		m_width, m_height;		// image dimensions
+	std::vector<std::vector<double> > m_sum;	// table per channel
+	std::vector<std::vector<double> > m_sq;		// squared, if requested
+};
+
+#endif	// INTEGRALIMAGE_H
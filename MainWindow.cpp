@@ -549,8 +549,10 @@ MainWindow::time()
 	// error checking
 	if(m_code <= 0) return;
 
-	// init current clock time
-	clock_t t = clock();
+	// init wall-clock timer; clock() would report CPU time summed
+	// over all threads once filters run in parallel
+	QElapsedTimer timer;
+	timer.start();
 
 	// run filter one hundred times
 	for(int i = 0; i < 100; ++i)
@@ -558,11 +560,9 @@ MainWindow::time()
 	if(m_checkboxGPU->checkState() ==  Qt::Checked)
 		// get the image from the last frame buffer pass
 		m_glw->setDstImage(m_imageFilter[m_code]->gpuPasses()-1);
-	// compute average execution time: divide elapsed time by number of iterations
-	double dt  = (clock() - t) / 100.;
 
-	// convert to milliseconds: multiply microseconds by 1000
-	dt *= (1000. / CLOCKS_PER_SEC);
+	// compute average execution time in milliseconds
+	double dt = timer.nsecsElapsed() / 100. * 1e-6;
 
 	// print result
 	m_labelTime->setText(QString("Execution time (ms): %1").arg(dt, 5, 'd', 3));
@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Median.h"
-//#include "hw2/HW_median.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { WSIZE, STEPX, STEPY, SAMPLER };
@@ -50,7 +50,7 @@ Median::controlPanel()
 		if(!i) {
 			// create slider
 			m_slider [i] = new QSlider(Qt::Horizontal, m_ctrlGrp);
-			m_slider [i]->setRange(3, 9);
+			m_slider [i]->setRange(3, 31);
 			m_slider [i]->setValue(3);
 			m_slider [i]->setSingleStep(2);
 			m_slider [i]->setTickInterval(1);
@@ -58,7 +58,7 @@ Median::controlPanel()
 
 			// create spinbox
 			m_spinBox[i] = new QSpinBox(m_ctrlGrp);
-			m_spinBox[i]->setRange(3, 9);
+			m_spinBox[i]->setRange(3, 31);
 			m_spinBox[i]->setValue(3);
 			m_spinBox[i]->setSingleStep(2);
 		} else {
@@ -117,13 +117,7 @@ Median::applyFilter(ImagePtr I1, bool gpuFlag, ImagePtr I2)
 	m_height = I1->height();
 	// apply median filter
 	if(!(gpuFlag && m_shaderFlag))
-		if(itrs == 1) {
-			median(I1, size, I2);
-		} else {
-			IP_copyImage(I1, I2);
-			for(int i=0; i<itrs; i++)
-				median(I2, size, I2);
-		}
+		median(I1, size, itrs, I2);
 	else    g_mainWindowP->glw()->applyFilterGPU(m_nPasses);
 
 
@@ -135,13 +129,13 @@ Median::applyFilter(ImagePtr I1, bool gpuFlag, ImagePtr I2)
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // Median::median:
 //
-// Apply median filter on image I1. Median filter has size sz x sz.
-// Output is in I2.
+// Apply median filter on image I1 itrs times. Median filter has size
+// sz x sz. Output is in I2.
 //
 void
-Median::median(ImagePtr I1, int sz, ImagePtr I2)
+Median::median(ImagePtr I1, int sz, int itrs, ImagePtr I2)
 {
-//	HW_median(I1, sz, I2);
+	HW_median(I1, sz, I2, itrs);
 }
 
 
@@ -20,7 +20,7 @@ public:
 	QGroupBox*	controlPanel	();				// create control panel
 	bool		applyFilter	(ImagePtr, bool, ImagePtr);	// apply filter to input
 	void		reset		();				// reset parameters
-	void		median		(ImagePtr, int, ImagePtr);
+	void		median		(ImagePtr, int, int, ImagePtr);
 	void		initShader();
 	void		gpuProgram(int pass);	// use GPU program to apply filter
 
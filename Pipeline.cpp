@@ -0,0 +1,279 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Pipeline.cpp - Chain of HW_* filters parsed from a text spec.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <chrono>
+#include <cctype>
+#include "Pipeline.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// trim:
+//
+// Return s without leading and trailing whitespace.
+//
+static std::string
+trim(const std::string &s)
+{
+	size_t a = 0, b = s.size();
+	while(a < b && isspace((uchar) s[a  ])) a++;
+	while(b > a && isspace((uchar) s[b-1])) b--;
+	return s.substr(a, b-a);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// parseArgs:
+//
+// Parse up to 4 numbers separated by ',' or 'x' into arg[].
+// Return the number of values read.
+//
+static int
+parseArgs(const std::string &s, double *arg)
+{
+	int n = 0;
+	const char *p = s.c_str();
+	while(*p && n < 4) {
+		char *endp;
+		double v = strtod(p, &endp);
+		if(endp == p) break;
+		arg[n++] = v;
+		p = endp;
+		while(*p == ',' || *p == 'x' || *p == 'X' || isspace((uchar) *p)) p++;
+	}
+	return n;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::Pipeline:
+//
+// Constructor.
+//
+Pipeline::Pipeline()
+{}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::parse:
+//
+// Parse pipeline spec: stages name:args separated by '|'.
+// Return true for success, false for failure.
+//
+bool
+Pipeline::parse(const char *spec)
+{
+	m_stages.clear();
+
+	std::string s(spec);
+	size_t start = 0;
+	for(;;) {
+		size_t end = s.find('|', start);
+		std::string str = trim(s.substr(start, end==std::string::npos ? end : end-start));
+		if(!str.empty()) {
+			PipelineStage stage;
+			if(!parseStage(str, stage)) {
+				m_stages.clear();
+				return false;
+			}
+			m_stages.push_back(stage);
+		}
+		if(end == std::string::npos) break;
+		start = end + 1;
+	}
+
+	if(m_stages.empty()) {
+		fprintf(stderr, "Pipeline: empty spec\n");
+		return false;
+	}
+	return true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::parseStage:
+//
+// Parse a single name:args stage into stage.
+// Missing arguments take the defaults of the qip control panels.
+// Return true for success, false for failure.
+//
+bool
+Pipeline::parseStage(const std::string &str, PipelineStage &stage)
+{
+	size_t colon = str.find(':');
+	std::string name = trim(str.substr(0, colon));
+	std::string args = (colon == std::string::npos) ? "" : trim(str.substr(colon+1));
+	for(size_t i=0; i<name.size(); i++) name[i] = tolower((uchar) name[i]);
+
+	stage.spec = str;
+	double *arg = stage.arg;
+	int	n   = parseArgs(args, arg);
+
+	if(name == "threshold") {
+		stage.op = STAGE_THRESHOLD;
+		if(n < 1) arg[0] = MXGRAY >> 1;
+	} else if(name == "clip") {
+		stage.op = STAGE_CLIP;
+		if(n < 2) { arg[0] = 0; arg[1] = MaxGray; }
+	} else if(name == "quantize") {
+		stage.op = STAGE_QUANTIZE;
+		if(n < 1) arg[0] = 16;
+		if(n < 2) arg[1] = 0;
+		if(n < 3) arg[2] = 0;
+	} else if(name == "gamma") {
+		stage.op = STAGE_GAMMA;
+		if(n < 1) arg[0] = 1.0;
+	} else if(name == "contrast") {
+		stage.op = STAGE_CONTRAST;
+		if(n < 1) arg[0] = 0;
+		if(n < 2) arg[1] = 1.0;
+	} else if(name == "histostretch") {
+		stage.op = STAGE_HISTOSTRETCH;
+		if(n < 2) { arg[0] = 0; arg[1] = MaxGray; }
+	} else if(name == "blur") {
+		stage.op = STAGE_BLUR;
+		if(n < 1) arg[0] = 3;
+		if(n < 2) arg[1] = arg[0];
+	} else if(name == "convolve") {
+		stage.op = STAGE_CONVOLVE;
+		stage.kernel = IP_readImage(args.c_str());
+		if(stage.kernel.isNull()) {
+			fprintf(stderr, "Pipeline: can't read kernel %s\n", args.c_str());
+			return false;
+		}
+		HW_convKernelInit(stage.kernel, stage.plan);
+	} else {
+		fprintf(stderr, "Pipeline: unknown stage %s\n", str.c_str());
+		return false;
+	}
+	return true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::applyStage:
+//
+// Apply stage i to I1. Output is in I2.
+// Stages are only read, so one pipeline may filter several images
+// concurrently.
+//
+void
+Pipeline::applyStage(int i, ImagePtr I1, ImagePtr I2) const
+{
+	const PipelineStage &s = m_stages[i];
+	switch(s.op) {
+	case STAGE_THRESHOLD:
+		HW_threshold(I1, (int) s.arg[0], I2);
+		break;
+	case STAGE_CLIP:
+		HW_clip(I1, (int) s.arg[0], (int) s.arg[1], I2);
+		break;
+	case STAGE_QUANTIZE:
+		HW_quantize(I1, (int) s.arg[0], s.arg[1] != 0, I2, (unsigned int) s.arg[2]);
+		break;
+	case STAGE_GAMMA:
+		HW_gammaCorrect(I1, s.arg[0], I2);
+		break;
+	case STAGE_CONTRAST:
+		HW_contrast(I1, s.arg[0], s.arg[1], I2);
+		break;
+	case STAGE_HISTOSTRETCH:
+		HW_histoStretch(I1, (int) s.arg[0], (int) s.arg[1], I2);
+		break;
+	case STAGE_BLUR:
+		HW_blur(I1, (int) s.arg[0], (int) s.arg[1], I2);
+		break;
+	case STAGE_CONVOLVE:
+		HW_convolveKernel(I1, s.plan, I2);
+		break;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::stageLut:
+//
+// If stage i is a point operation that can be expressed as a lookup
+// table, init lut with it and return true. Dithered quantization
+// depends on pixel position, so it is not a lookup table.
+//
+bool
+Pipeline::stageLut(int i, uchar *lut) const
+{
+	const PipelineStage &s = m_stages[i];
+	switch(s.op) {
+	case STAGE_THRESHOLD:
+		HW_thresholdLut((int) s.arg[0], lut);
+		return true;
+	case STAGE_CLIP:
+		HW_clipLut((int) s.arg[0], (int) s.arg[1], lut);
+		return true;
+	case STAGE_QUANTIZE:
+		if(s.arg[1] != 0) return false;
+		HW_quantizeLut((int) s.arg[0], lut);
+		return true;
+	case STAGE_GAMMA:
+		HW_gammaLut(s.arg[0], lut);
+		return true;
+	case STAGE_CONTRAST:
+		HW_contrastLut(s.arg[0], s.arg[1], lut);
+		return true;
+	case STAGE_HISTOSTRETCH:
+		HW_histoStretchLut((int) s.arg[0], (int) s.arg[1], lut);
+		return true;
+	}
+	return false;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pipeline::apply:
+//
+// Apply all stages to I1. Output is in I2.
+// Intermediate results ping-pong between two scratch images.
+// Runs of consecutive lookup-table stages (see stageLut) are composed
+// into a single table and applied in one pass over the image.
+// If secs is given, the wall-clock time of stage i is added to secs[i];
+// the time of a fused run is charged to its first stage.
+//
+void
+Pipeline::apply(ImagePtr I1, ImagePtr I2, double *secs) const
+{
+	typedef std::chrono::steady_clock Clock;
+
+	ImagePtr Isrc = I1;
+	ImagePtr Itmp[2];
+	uchar	 lut[MXGRAY], lut2[MXGRAY];
+	int n = stages();
+	for(int i=0, pass=0; i<n; pass++) {
+		Clock::time_point t = Clock::now();
+
+		// extend run of lookup-table stages [i,j)
+		int j = i;
+		if(stageLut(i, lut))
+			for(j=i+1; j<n && stageLut(j, lut2); j++)
+				HW_composeLut(lut, lut2, lut);
+
+		ImagePtr Idst = (MAX(j, i+1) == n) ? I2 : Itmp[pass&1];
+		if(j > i) {
+			IP_copyImageHeader(Isrc, Idst);
+			HW_applyLut(Isrc, lut, Idst);
+		} else	applyStage(i, Isrc, Idst);
+
+		if(secs)
+			secs[i] += std::chrono::duration<double>(Clock::now() - t).count();
+		Isrc = Idst;
+		i    = MAX(j, i+1);
+	}
+}
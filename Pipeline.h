@@ -0,0 +1,49 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Pipeline.h - Chain of HW_* filters parsed from a text spec.
+//
+// A spec lists stages separated by '|'. Each stage is name:args, e.g.
+//	threshold:128 | blur:7x7 | convolve:kernels/kernelEdgeX.AF
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <string>
+#include <vector>
+#include "HW.h"
+
+enum {
+	STAGE_THRESHOLD, STAGE_CLIP, STAGE_QUANTIZE, STAGE_GAMMA, STAGE_CONTRAST,
+	STAGE_HISTOSTRETCH, STAGE_BLUR, STAGE_CONVOLVE
+};
+
+struct PipelineStage {
+	int		op;		// STAGE_* opcode
+	std::string	spec;		// stage as spelled in the pipeline spec
+	double		arg[4];		// numeric arguments
+	ImagePtr	kernel;		// convolution kernel (STAGE_CONVOLVE)
+	HW_convKernel	plan;		// kernel analyzed once for all images
+};
+
+class Pipeline {
+public:
+	Pipeline			();
+	bool		parse		(const char *);		// parse pipeline spec
+	int		stages		() const { return (int) m_stages.size(); }
+	const char*	stageSpec	(int i) const { return m_stages[i].spec.c_str(); }
+	void		applyStage	(int, ImagePtr, ImagePtr) const; // run one stage
+	bool		stageLut	(int, uchar *lut) const;	// point op as lut
+	void		apply		(ImagePtr, ImagePtr, double *secs = NULL) const;
+
+private:
+	bool		parseStage	(const std::string &, PipelineStage &);
+
+	std::vector<PipelineStage> m_stages;
+};
+
+#endif	// PIPELINE_H
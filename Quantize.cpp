@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Quantize.h"
-#include "hw1/HW_quantize.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { LEVELS, DITHER, SAMPLER };
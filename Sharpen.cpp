@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Sharpen.h"
-//#include "hw2/HW_sharpen.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 enum { WSIZE, FACTOR, STEPX, STEPY, SAMPLER };
@@ -127,7 +127,7 @@ Sharpen::applyFilter(ImagePtr I1, bool gpuFlag, ImagePtr I2)
 void
 Sharpen::sharpen(ImagePtr I1, int size, double factor, ImagePtr I2)
 {
-//	HW_sharpen(I1, size, factor, I2);
+	HW_sharpen(I1, size, factor, I2);
 }
 
 
@@ -0,0 +1,127 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Simd.cpp - Runtime detection of x86 SIMD instruction set extensions.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <cstdlib>
+#include <cstring>
+#include "Simd.h"
+
+#ifdef SIMD_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// SIMD_cpuid:
+//
+// Execute cpuid for leaf and subleaf; registers are returned in r[].
+//
+static void
+SIMD_cpuid(int leaf, int subleaf, unsigned int r[4])
+{
+#ifdef _MSC_VER
+	int v[4];
+	__cpuidex(v, leaf, subleaf);
+	for(int i=0; i<4; i++) r[i] = v[i];
+#else
+	r[0] = r[1] = r[2] = r[3] = 0;
+	__cpuid_count(leaf, subleaf, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// SIMD_xgetbv:
+//
+// Return the register state enabled by the OS (XCR0).
+//
+static unsigned long long
+SIMD_xgetbv()
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned int lo, hi;
+	__asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return ((unsigned long long) hi << 32) | lo;
+#endif
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// SIMD_detect:
+//
+// Query the CPU for supported extensions. AVX and AVX-512 also need
+// the OS to save the wider registers on context switches.
+//
+static int
+SIMD_detect()
+{
+	unsigned int r[4];
+	SIMD_cpuid(0, 0, r);
+	int maxleaf = r[0];
+
+	int features = 0;
+	SIMD_cpuid(1, 0, r);
+	bool sse41   = (r[2] >> 19) & 1;
+	bool osxsave = (r[2] >> 27) & 1;
+	if(sse41) features |= SIMD_SSE41;
+	if(!osxsave || maxleaf < 7) return features;
+
+	unsigned long long xcr0 = SIMD_xgetbv();
+	bool ymm = (xcr0 & 0x06) == 0x06;	// XMM and YMM state
+	bool zmm = (xcr0 & 0xe6) == 0xe6;	// and opmask, ZMM state
+
+	SIMD_cpuid(7, 0, r);
+	if(ymm && ((r[1] >> 5) & 1)) features |= SIMD_AVX2;
+#ifdef SIMD_AVX512
+	if(zmm && ((r[1] >> 16) & 1) && ((r[1] >> 30) & 1)) {
+		features |= SIMD_AVX512BW;
+		if((r[2] >> 1) & 1) features |= SIMD_AVX512VBMI;
+	}
+#else
+	(void) zmm;			// kernels not compiled
+#endif
+	return features;
+}
+#endif	// SIMD_X86
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// SIMD_features:
+//
+// Return the extensions that kernels may use, as SIMD_* bits.
+// Detection runs once. Set QIP_SIMD=scalar to force the scalar code
+// paths, or sse4/avx2 to cap the extensions used.
+//
+static std::once_flag	featuresOnce;
+static int		features;
+
+int
+SIMD_features()
+{
+	std::call_once(featuresOnce, []() {
+		int f = 0;
+#ifdef SIMD_X86
+		f = SIMD_detect();
+#endif
+		const char *cap = getenv("QIP_SIMD");
+		if(cap) {
+			if     (!strcmp(cap, "scalar")) f  = 0;
+			else if(!strcmp(cap, "sse4"))	f &= SIMD_SSE41;
+			else if(!strcmp(cap, "avx2"))	f &= SIMD_SSE41 | SIMD_AVX2;
+		}
+		features = f;
+	});
+	return features;
+}
@@ -0,0 +1,60 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Simd.h - Runtime detection of x86 SIMD instruction set extensions.
+//
+// Kernels with vector code keep a bit-exact scalar version and pick an
+// implementation at run time from SIMD_features(), so one binary runs
+// on any x86 (or non-x86) machine. Vector functions are compiled for
+// their extension with SIMD_TARGET, not with global compiler flags.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <mutex>
+
+// instruction set extensions, as bits returned by SIMD_features()
+enum {
+	SIMD_SSE41	= 1,		// SSE4.1 (includes SSSE3 pshufb)
+	SIMD_AVX2	= 2,		// AVX2
+	SIMD_AVX512BW	= 4,		// AVX-512 F + BW
+	SIMD_AVX512VBMI	= 8		// AVX-512 VBMI byte permutes
+};
+
+// extensions supported by the CPU and OS, limited by environment
+// variable QIP_SIMD (scalar, sse4, avx2, or avx512)
+extern int	SIMD_features	();
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_X86
+#endif
+
+// AVX-512 intrinsics: GCC and Clang, or MSVC 2017 15.3 and later
+#if defined(SIMD_X86) && (defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1911))
+#define SIMD_AVX512
+#endif
+
+// compile one function for an extension
+#if defined(SIMD_X86) && defined(__GNUC__)
+#define SIMD_TARGET(isa)	__attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa)
+#endif
+
+// SIMD_select: return the implementation picked by select() on the first
+// call with flag once, cached in fn. Function-local statics are not
+// initialized thread-safely by MSVC 2013, so kernels keep once and fn
+// at file scope instead.
+template<class Fn>
+inline Fn
+SIMD_select(std::once_flag &once, Fn &fn, Fn (*select)())
+{
+	std::call_once(once, [&]() { fn = select(); });
+	return fn;
+}
+
+#endif	// SIMD_H
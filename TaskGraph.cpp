@@ -0,0 +1,108 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// TaskGraph.cpp - Tasks with dependencies, executed on the ThreadPool.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <cstdio>
+#include "TaskGraph.h"
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TaskGraph::add:
+//
+// Add task fn to the graph and return its id.
+//
+int
+TaskGraph::add(const std::function<void()> &fn)
+{
+	Node node;
+	node.fn	  = fn;
+	node.deps = 0;
+	m_nodes.push_back(node);
+	return (int) m_nodes.size() - 1;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TaskGraph::depend:
+//
+// Make task wait for task on to finish before it starts.
+//
+void
+TaskGraph::depend(int task, int on)
+{
+	m_nodes[on].succ.push_back(task);
+	m_nodes[task].deps++;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TaskGraph::run:
+//
+// Execute all tasks on the ThreadPool, each as soon as its dependencies
+// have finished, and return when all are done. The calling thread
+// executes tasks too. Return false, running nothing, if the
+// dependencies contain a cycle.
+//
+bool
+TaskGraph::run()
+{
+	int n = (int) m_nodes.size();
+	if(!n) return true;
+
+	// reject cycles: every task must be reachable in topological order
+	std::vector<int> deps(n), order;
+	for(int i=0; i<n; i++) {
+		deps[i] = m_nodes[i].deps;
+		if(!deps[i]) order.push_back(i);
+	}
+	for(size_t k=0; k<order.size(); k++) {
+		const std::vector<int> &succ = m_nodes[order[k]].succ;
+		for(size_t j=0; j<succ.size(); j++)
+			if(!--deps[succ[j]]) order.push_back(succ[j]);
+	}
+	if((int) order.size() != n) {
+		fprintf(stderr, "TaskGraph: dependency cycle\n");
+		return false;
+	}
+
+	// every task is counted in group from the start, so the group cannot
+	// drain before successors of a finishing task have been submitted
+	std::atomic<int> group(n);
+	m_wait.reset(new std::atomic<int>[n]);
+	m_tasks.assign(n, ThreadTask());
+	for(int i=0; i<n; i++) {
+		m_wait[i]	   = m_nodes[i].deps;
+		m_tasks[i].fn	   = [this, i]() { m_nodes[i].fn(); finish(i); };
+		m_tasks[i].group   = &group;
+	}
+
+	ThreadPool &pool = ThreadPool::instance();
+	for(int i=0; i<n; i++)
+		if(!m_nodes[i].deps) pool.submit(&m_tasks[i]);
+	pool.wait(group);
+	return true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TaskGraph::finish:
+//
+// Task i is done: submit successors whose last dependency this was.
+//
+void
+TaskGraph::finish(int i)
+{
+	const std::vector<int> &succ = m_nodes[i].succ;
+	for(size_t j=0; j<succ.size(); j++)
+		if(--m_wait[succ[j]] == 0)
+			ThreadPool::instance().submit(&m_tasks[succ[j]]);
+}
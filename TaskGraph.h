@@ -0,0 +1,46 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// TaskGraph.h - Tasks with dependencies, executed on the ThreadPool.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef TASKGRAPH_H
+#define TASKGRAPH_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "ThreadPool.h"
+
+// Usage:
+//	TaskGraph g;
+//	int a = g.add([&]() { read  (); });
+//	int b = g.add([&]() { filter(); });
+//	g.depend(b, a);				// b runs after a
+//	g.run();
+//
+class TaskGraph {
+public:
+	int		add		(const std::function<void()> &);
+	void		depend		(int task, int on);
+	bool		run		();
+	int		tasks		() const { return (int) m_nodes.size(); }
+
+private:
+	struct Node {
+		std::function<void()>	fn;		// task body
+		std::vector<int>	succ;		// tasks that depend on this one
+		int			deps;		// number of tasks this one depends on
+	};
+	void		finish		(int);
+
+	std::vector<Node>		m_nodes;
+	std::vector<ThreadTask>		m_tasks;	// pool tasks, one per node
+	std::unique_ptr<std::atomic<int>[]> m_wait;	// unfinished dependencies
+};
+
+#endif	// TASKGRAPH_H
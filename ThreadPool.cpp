@@ -0,0 +1,375 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// ThreadPool.cpp - Process-wide work-stealing pool of worker threads.
+//
+// Every worker owns a deque of tasks. A worker pushes and pops its own
+// tasks at the back (newest first, so nested work stays cache-warm) and
+// steals from the front of other deques (oldest first, so thieves take
+// large, independent pieces). Threads outside the pool submit into a
+// shared inject deque. A thread waiting for its tasks to finish keeps
+// executing queued tasks instead of blocking, so pool calls may be
+// nested to any depth without deadlock.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include "ThreadPool.h"
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+// thread-local storage: MSVC 2013 has no thread_local, but its
+// __declspec(thread) holds a constant-initialized int as well
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define THREAD_LOCAL	__declspec(thread)
+#else
+#define THREAD_LOCAL	thread_local
+#endif
+
+// index of the calling thread's worker; -1 outside the pool
+static THREAD_LOCAL int t_index = -1;
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::instance:
+//
+// Return the process-wide pool. By default it has one thread per
+// hardware thread, counting the caller, which always takes part in
+// parallel_for(). Environment variables QIP_THREADS (thread count) and
+// QIP_PIN (nonzero: pin workers to cores) override the defaults.
+// The pool is built on first use with std::call_once, as MSVC 2013 does
+// not initialize function-local statics thread-safely, and destroyed
+// at exit.
+//
+static std::once_flag	poolOnce;
+static ThreadPool      *pool;
+
+ThreadPool&
+ThreadPool::instance()
+{
+	std::call_once(poolOnce, []() {
+		pool = new ThreadPool;
+		atexit([]() { delete pool; });
+	});
+	return *pool;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::ThreadPool:
+//
+// Constructor.
+//
+ThreadPool::ThreadPool()
+	: m_pending(0), m_sleeping(0), m_quit(false)
+{
+	const char *s = getenv("QIP_THREADS");
+	const char *p = getenv("QIP_PIN");
+	start(s ? atoi(s) : 0, p && atoi(p));
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::~ThreadPool:
+//
+// Destructor. Stop and join all workers.
+//
+ThreadPool::~ThreadPool()
+{
+	stop();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::configure:
+//
+// Restart the pool with the given number of threads (including the
+// caller; <= 0 means one per hardware thread). If pin is set, worker i
+// is bound to core i+1, leaving core 0 to the caller (Linux only).
+// Must not be called while tasks are in flight.
+//
+void
+ThreadPool::configure(int threads, bool pin)
+{
+	stop();
+	start(threads, pin);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::start:
+//
+// Start threads-1 workers.
+//
+void
+ThreadPool::start(int threads, bool pin)
+{
+	int cores = std::max((int) std::thread::hardware_concurrency(), 1);
+	if(threads <= 0) threads = cores;
+
+	m_quit = false;
+	for(int i=0; i<threads-1; i++) m_workers.push_back(new Worker);
+	for(int i=0; i<threads-1; i++) {
+		m_workers[i]->thread = std::thread(&ThreadPool::loop, this, i);
+#ifdef __linux__
+		if(pin) {
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET((i+1) % cores, &set);
+			pthread_setaffinity_np(m_workers[i]->thread.native_handle(),
+					       sizeof(set), &set);
+		}
+#else
+		(void) pin;
+#endif
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::stop:
+//
+// Stop, join, and delete all workers.
+//
+void
+ThreadPool::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_wake.notify_all();
+	for(size_t i=0; i<m_workers.size(); i++) {
+		m_workers[i]->thread.join();
+		delete m_workers[i];
+	}
+	m_workers.clear();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::parallel_for:
+//
+// Call fn(lo,hi) on consecutive subranges covering [begin,end) and
+// return when all calls are done. Subranges have at least grain
+// elements; at most 4 per thread are made, for load balancing. A range
+// of a single grain runs inline with no synchronization at all, so
+// small images cost no more than the serial code.
+//
+void
+ThreadPool::parallel_for(int begin, int end, int grain,
+			 const std::function<void(int, int)> &fn)
+{
+	int n = end - begin;
+	if(n <= 0) return;
+	grain = std::max(grain, 1);
+
+	int chunks = std::min((n + grain - 1) / grain, 4 * threads());
+	if(chunks <= 1) {
+		fn(begin, end);
+		return;
+	}
+	int size = (n + chunks - 1) / chunks;
+	chunks	 = (n + size - 1) / size;
+
+	// caller runs the first subrange; the rest go to the pool
+	std::atomic<int>	group(chunks - 1);
+	std::vector<ThreadTask> tasks(chunks - 1);
+	for(int c=1; c<chunks; c++) {
+		int lo = begin + c*size;
+		int hi = std::min(lo + size, end);
+		tasks[c-1].fn	 = [&fn, lo, hi]() { fn(lo, hi); };
+		tasks[c-1].group = &group;
+	}
+	submit(&tasks[0], chunks - 1);
+	fn(begin, begin + size);
+	wait(group);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::run:
+//
+// Call fn(i) for i in [0,n) and return when all calls are done.
+//
+void
+ThreadPool::run(int n, const std::function<void(int)> &fn)
+{
+	parallel_for(0, n, 1, [&fn](int lo, int hi) {
+		for(int i=lo; i<hi; i++) fn(i);
+	});
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::submit:
+//
+// Queue n tasks on the calling worker's deque (or the inject deque if
+// the caller is not a pool thread) and wake sleeping threads.
+//
+void
+ThreadPool::submit(ThreadTask *tasks, int n)
+{
+	if(n <= 0) return;
+	Worker *w = (t_index >= 0) ? m_workers[t_index] : &m_inject;
+
+	// count first: a thread that sees m_pending > 0 but finds nothing
+	// just looks again, while the reverse order could let it sleep
+	m_pending += n;
+	{
+		std::lock_guard<std::mutex> lock(w->mutex);
+		for(int i=0; i<n; i++) w->tasks.push_back(&tasks[i]);
+	}
+	notify();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::wait:
+//
+// Execute queued tasks until group drops to zero. When no task is
+// left to take, the remaining ones in group are running on other
+// threads, and the caller sleeps until one of them finishes.
+//
+void
+ThreadPool::wait(std::atomic<int> &group)
+{
+	while(group > 0) {
+		ThreadTask *t = find();
+		if(t) {
+			execute(t);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_sleeping++;
+		while(group > 0 && m_pending <= 0) m_wake.wait(lock);
+		m_sleeping--;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::loop:
+//
+// Worker loop: execute own and stolen tasks; sleep when none are left.
+//
+void
+ThreadPool::loop(int index)
+{
+	t_index = index;
+	for(;;) {
+		ThreadTask *t = find();
+		if(t) {
+			execute(t);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_sleeping++;
+		while(!m_quit && m_pending <= 0) m_wake.wait(lock);
+		m_sleeping--;
+		if(m_quit) return;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::pop:
+//
+// Take a task from the back or front of w's deque, or return NULL.
+//
+ThreadTask *
+ThreadPool::pop(Worker *w, bool back)
+{
+	std::lock_guard<std::mutex> lock(w->mutex);
+	if(w->tasks.empty()) return NULL;
+
+	ThreadTask *t;
+	if(back) {
+		t = w->tasks.back();
+		w->tasks.pop_back();
+	} else {
+		t = w->tasks.front();
+		w->tasks.pop_front();
+	}
+	m_pending--;
+	return t;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::find:
+//
+// Find a task for the calling thread: its own newest task first, then
+// the oldest task from outside the pool, then steal the oldest task of
+// the next worker that has one.
+//
+ThreadTask *
+ThreadPool::find()
+{
+	if(m_pending <= 0) return NULL;
+
+	ThreadTask *t;
+	int self = t_index;
+	int n	 = (int) m_workers.size();
+	if(self >= 0 && (t = pop(m_workers[self], true))) return t;
+	if((t = pop(&m_inject, false))) return t;
+	for(int k=1; k<=n; k++) {
+		int victim = (self + k) % n;
+		if(victim == self) continue;
+		if((t = pop(m_workers[victim], false))) return t;
+	}
+	return NULL;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::execute:
+//
+// Run task t and retire it from its group. t and its group may be
+// destroyed by the waiting thread as soon as the group drops to zero.
+//
+void
+ThreadPool::execute(ThreadTask *t)
+{
+	std::atomic<int> *group = t->group;
+	t->fn();
+	if(--*group == 0) notify();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// ThreadPool::notify:
+//
+// Wake sleeping threads. Callers update m_pending or a group counter
+// before calling; sleepers bump m_sleeping before testing them, so one
+// side always sees the other and no wakeup is lost.
+//
+void
+ThreadPool::notify()
+{
+	if(m_sleeping > 0) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_wake.notify_all();
+	}
+}
@@ -0,0 +1,67 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// ThreadPool.h - Process-wide work-stealing pool of worker threads.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// unit of work submitted to the pool; the pool never owns tasks, so the
+// submitter keeps them alive until its group counter drops to zero
+struct ThreadTask {
+	std::function<void()>	 fn;		// task body
+	std::atomic<int>	*group;		// decremented when fn returns
+};
+
+class ThreadPool {
+public:
+	static ThreadPool& instance	();			// process-wide pool
+	void		configure	(int threads, bool pin = false);
+	int		threads		() const { return (int) m_workers.size() + 1; }
+	void		parallel_for	(int begin, int end, int grain,
+					 const std::function<void(int, int)> &);
+	void		run		(int, const std::function<void(int)> &);
+
+	// low-level interface used by parallel_for() and TaskGraph
+	void		submit		(ThreadTask *, int n = 1);
+	void		wait		(std::atomic<int> &group);
+
+private:
+	struct Worker {
+		std::mutex		mutex;		// guards tasks
+		std::deque<ThreadTask*>	tasks;		// owner pops back, thieves pop front
+		std::thread		thread;
+	};
+
+	ThreadPool			();
+	~ThreadPool			();
+	void		start		(int, bool);
+	void		stop		();
+	void		loop		(int);
+	ThreadTask     *pop		(Worker *, bool back);
+	ThreadTask     *find		();
+	void		execute		(ThreadTask *);
+	void		notify		();
+
+	std::vector<Worker*>	 m_workers;	// workers (caller is one more)
+	Worker			 m_inject;	// tasks from threads outside the pool
+	std::atomic<int>	 m_pending;	// queued tasks not yet claimed
+	std::atomic<int>	 m_sleeping;	// threads blocked on m_wake
+	std::mutex		 m_mutex;
+	std::condition_variable	 m_wake;	// new task, finished group, or quit
+	bool			 m_quit;
+};
+
+#endif	// THREADPOOL_H
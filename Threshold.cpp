@@ -9,7 +9,7 @@
 
 #include "MainWindow.h"
 #include "Threshold.h"
-#include "hw1/HW_threshold.cpp"
+#include "HW.h"
 
 extern MainWindow *g_mainWindowP;
 
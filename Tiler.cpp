@@ -0,0 +1,94 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Tiler.cpp - Split an output image into cache-sized tiles and run them
+//	       on the ThreadPool.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <cmath>
+#include "IPdefs.h"
+#include "Tiler.h"
+#include "ThreadPool.h"
+
+using namespace IP;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tiler::Tiler:
+//
+// Constructor. Tile a w x h output for a filter of radius halo reading
+// bpp bytes per input pixel. Tiles are sized so that a tile plus its
+// halo fits in TILE_CACHE_BYTES; small images form a single tile.
+//
+Tiler::Tiler(int w, int h, int halo, int bpp)
+	: m_width(w), m_height(h), m_halo(halo)
+{
+	if(w * h <= TILE_MIN_PIXELS) {
+		setTileSize(w, h);
+		return;
+	}
+
+	// widest tile that keeps rows long, then as many rows as fit
+	int pixels = TILE_CACHE_BYTES / MAX(bpp, 1);
+	int side   = (int) sqrt((double) pixels) - 2*halo;
+	int tw	   = MIN(w, MAX(side, 64));
+	int th	   = pixels / (tw + 2*halo) - 2*halo;
+	setTileSize(tw, MAX(th, 16));
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tiler::setTileSize:
+//
+// Use tw x th tiles (clamped to the image). Filters that stream rows,
+// such as the running-sum blur, use full-width strips. Tiles are made
+// at least TILE_MIN_PIXELS large so that scheduling never costs more
+// than the work in a tile.
+//
+void
+Tiler::setTileSize(int tw, int th)
+{
+	tw	= MAX(tw, 1);
+	th	= MAX(th, (TILE_MIN_PIXELS + tw - 1) / tw);
+	m_tileW = CLIP(tw, 1, MAX(m_width,  1));
+	m_tileH = CLIP(th, 1, MAX(m_height, 1));
+	m_nx	= (m_width  + m_tileW - 1) / m_tileW;
+	m_ny	= (m_height + m_tileH - 1) / m_tileH;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tiler::tile:
+//
+// Return tile i in raster order.
+//
+Tile
+Tiler::tile(int i) const
+{
+	Tile t;
+	t.x0 = (i % m_nx) * m_tileW;
+	t.y0 = (i / m_nx) * m_tileH;
+	t.x1 = MIN(t.x0 + m_tileW, m_width );
+	t.y1 = MIN(t.y0 + m_tileH, m_height);
+	return t;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Tiler::run:
+//
+// Call fn on every tile, spread over the ThreadPool.
+// fn writes its tile of the output directly; tiles never overlap, so no
+// locking or copying is needed. fn must not copy ImagePtr objects,
+// whose reference counts are not thread-safe: capture channel pointers.
+//
+void
+Tiler::run(const std::function<void(const Tile&)> &fn) const
+{
+	ThreadPool::instance().run(tiles(), [&](int i) { fn(tile(i)); });
+}
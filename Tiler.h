@@ -0,0 +1,41 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// Tiler.h - Split an output image into cache-sized tiles and run them
+//	     on the ThreadPool.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#ifndef TILER_H
+#define TILER_H
+
+#include <functional>
+
+#define TILE_CACHE_BYTES	(256*1024)	// per-tile input working set
+#define TILE_MIN_PIXELS		(64*64)		// below this, don't bother
+
+// output region [x0,x1) x [y0,y1); input needed is that region grown
+// by the tiler's halo on every side (clamped by the filter at borders)
+struct Tile {
+	int	x0, y0;
+	int	x1, y1;
+};
+
+class Tiler {
+public:
+	Tiler				(int w, int h, int halo = 0, int bpp = 1);
+	void		setTileSize	(int tw, int th);	// override default tile size
+	int		tiles		() const { return m_nx * m_ny; }
+	Tile		tile		(int) const;
+	void		run		(const std::function<void(const Tile&)> &) const;
+
+private:
+	int		m_width, m_height;	// output dimensions
+	int		m_halo;			// kernel radius
+	int		m_tileW, m_tileH;	// tile dimensions
+	int		m_nx,	 m_ny;		// tiles across and down
+};
+
+#endif	// TILER_H
@@ -1,3 +1,22 @@
+#include "HW.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_clipLut:
+//
+// Init lookup table lut to clip intensities to [t1,t2] range.
+//
+void
+HW_clipLut(int t1, int t2, uchar *lut)
+{
+	for(int i=0; i<MXGRAY; i++) {
+		if(i < t1)	lut[i] = t1;
+		else if(i > t2)	lut[i] = t2;
+		else		lut[i] = i;
+	}
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_clip:
 //
@@ -10,23 +29,11 @@ void
 HW_clip(ImagePtr I1, int t1, int t2, ImagePtr I2)
 {
 	IP_copyImageHeader(I1, I2);
-	int w = I1->width ();
-	int h = I1->height();
-	int total = w * h;
 
 	// init lookup table
-	int lut[MXGRAY];
-	for(int i=0; i<MXGRAY; i++) {
-		if(i < t1)	lut[i] = t1;
-		else if(i > t2)	lut[i] = t2;
-		else		lut[i] = i;
-	}
+	uchar lut[MXGRAY];
+	HW_clipLut(t1, t2, lut);
 
 	// evaluate output: each input pixel indexes into lut[] to eval output
-	int type;
-	ChannelPtr<uchar> p1, p2, endd;
-	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-		IP_getChannel(I2, ch, p2, type);
-		for(endd = p1 + total; p1<endd;) *p2++ = lut[*p1++];
-	}
+	HW_applyLut(I1, lut, I2);
 }
@@ -1,3 +1,23 @@
+#include "HW.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_contrastLut:
+//
+// Init lookup table lut for contrast enhancement: multiply by contrast;
+// add brightness.
+//
+void
+HW_contrastLut(double brightness, double contrast, uchar *lut)
+{
+	double shift = 128 + brightness;
+	for(int i=0; i<MXGRAY; i++) {
+		int val = ROUND((i-128)*contrast) + shift;
+		lut[i] = CLIP(val, 0, MaxGray);
+	}
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_contrast:
 //
@@ -10,23 +30,11 @@ void
 HW_contrast(ImagePtr I1, double brightness, double contrast, ImagePtr I2)
 {
 	IP_copyImageHeader(I1, I2);
-	int w = I1->width ();
-	int h = I1->height();
-	int total = w * h;
 
-	// init lookup table: multiply by contrast; add brightness
-	int lut[MXGRAY];
-	double shift = 128 + brightness;
-	for(int i=0; i<MXGRAY; i++) {
-		int val = ROUND((i-128)*contrast) + shift;
-		lut[i] = CLIP(val, 0, MaxGray);
-	}
+	// init lookup table
+	uchar lut[MXGRAY];
+	HW_contrastLut(brightness, contrast, lut);
 
 	// evaluate output: each input pixel indexes into lut[] to eval output
-	int type;
-	ChannelPtr<uchar> p1, p2, endd;
-	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-		IP_getChannel(I2, ch, p2, type);
-		for(endd = p1 + total; p1<endd;) *p2++ = lut[*p1++];
-	}
+	HW_applyLut(I1, lut, I2);
 }
@@ -1,3 +1,5 @@
+#include "HW.h"
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_histoMatch:
 //
@@ -24,7 +26,6 @@ HW_histoMatch(ImagePtr I1, ImagePtr Ilut, ImagePtr I2)
 
 	int	  h1[MXGRAY],   lim[MXGRAY], luttype=0, *h2, t=0, R;
 	int	left[MXGRAY], right[MXGRAY], indx[MXGRAY];
-	double	hmin, hmax;
 	ChannelPtr<uchar> p, endd, lutp;
 	for(int ch=0; IP_getChannel(I2, ch, p, t); ch++) {
 		IP_getChannel(Ilut, ch, lutp, luttype);
@@ -47,7 +48,7 @@ HW_histoMatch(ImagePtr I1, ImagePtr Ilut, ImagePtr I2)
 		}
 
 		// eval h1 and init left[], right[], and lim[]
-		IP_histogram(I2, ch, h1, MXGRAY, hmin, hmax);
+		HW_histogram(I2, ch, h1);
 		R = Hsum = 0;
 		for(int i=0; i<MXGRAY; i++) {
 			left[i] = indx[i] = R;	// left end of interval
@@ -1,3 +1,34 @@
+#include "HW.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_histoStretchLut:
+//
+// Init lookup table lut for histogram stretching between t1 and t2.
+// The clip table and the scale table are composed into lut, so the
+// image is processed in a single pass.
+//
+void
+HW_histoStretchLut(int t1, int t2, uchar *lut)
+{
+	// init clip lut
+	uchar lutClip[MXGRAY];
+	HW_clipLut(t1, t2, lutClip);
+
+	// error checking: avoid divide-by-zero error later
+	if(t1 == t2) t2++;
+
+	// init scale lut
+	uchar lutScale[MXGRAY];
+	double scale = (double) MaxGray / (t2 - t1);
+	for(int i=0; i<MXGRAY; i++)
+		lutScale[i] = (int) ((i-t1)*scale);
+
+	// clip, then scale
+	HW_composeLut(lutClip, lutScale, lut);
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_histoStretch:
 //
@@ -8,39 +39,11 @@ void
 HW_histoStretch(ImagePtr I1, int t1, int t2, ImagePtr I2)
 {
 	IP_copyImageHeader(I1, I2);
-	int w = I1->width ();
-	int h = I1->height();
-	int total = w * h;
 
-	// init clip lut
-	int lutClip[MXGRAY];
-	for(int i=0; i<MXGRAY; i++) {
-		if	(i < t1) lutClip[i] = t1;
-		else if	(i > t2) lutClip[i] = t2;
-		else		 lutClip[i] = i;
-	}
-
-	// evaluate output
-	int type;
-	int lutScale[MXGRAY];
-	ChannelPtr<uchar> p1, p2, endd;
-	double	scale;
-	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-		IP_getChannel(I2, ch, p2, type);
-
-		// clip image: apply lutClip table
-		for(endd = p1 + total; p1<endd;) *p2++ = lutClip[*p1++];
-
-		// error checking: avoid divide-by-zero error later
-		if(t1 == t2) t2++;
-
-		// init lookup table
-		scale = (double) MaxGray / (t2 - t1);
-		for(int i=0; i<MXGRAY; i++)
-			lutScale[i] = (i-t1)*scale;
-
-		// apply lookup table
-		IP_getChannel(I2, ch, p2, type);
-		for(endd = p2 + total; p2<endd; p2++) *p2 = lutScale[*p2];
-	}
+	// init lookup table
+	uchar lut[MXGRAY];
+	HW_histoStretchLut(t1, t2, lut);
+
+	// evaluate output: each input pixel indexes into lut[] to eval output
+	HW_applyLut(I1, lut, I2);
 }
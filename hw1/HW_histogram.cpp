@@ -0,0 +1,32 @@
+#include "HW.h"
+#include "ThreadPool.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_histogram:
+//
+// Compute the MXGRAY-bin histogram of uchar channel ch of I.
+// Output is in histo.
+//
+// Ranges of pixels are counted in parallel into private histograms,
+// which are then added into histo.
+//
+void
+HW_histogram(ImagePtr I, int ch, int *histo)
+{
+	int total = I->width() * I->height();
+	for(int i=0; i<MXGRAY; i++) histo[i] = 0;
+
+	int type;
+	ChannelPtr<uchar> p;
+	if(!IP_getChannel(I, ch, p, type)) return;
+	const uchar *src = &p[0];
+
+	std::mutex mutex;
+	ThreadPool::instance().parallel_for(0, total, 1<<16, [&](int lo, int hi) {
+		int h[MXGRAY] = {0};
+		for(int i=lo; i<hi; i++) h[src[i]]++;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		for(int i=0; i<MXGRAY; i++) histo[i] += h[i];
+	});
+}
@@ -0,0 +1,133 @@
+#include <cstring>
+#include "HW.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*HW_lutFn)(const uchar*, int, const uchar*, uchar*);
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_lutScalar:
+//
+// Reference implementation: dst[i] = lut[src[i]] for n pixels.
+//
+static void
+HW_lutScalar(const uchar *src, int n, const uchar *lut, uchar *dst)
+{
+	for(int i=0; i<n; i++) dst[i] = lut[src[i]];
+}
+
+
+
+#ifdef SIMD_AVX512
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_lutAVX512:
+//
+// vpermi2b looks up 64 bytes in a 128-entry table held in two
+// registers, using the low 7 bits of each index. Two lookups cover the
+// 256-entry lut and bit 7 of the pixel selects between them. The tail
+// is handled with masked loads and stores.
+//
+// There is no SSE4/AVX2 version: pshufb only indexes 16 entries, so a
+// 256-entry lut takes 16 shuffles plus 16 selects per vector, which
+// runs slower than the scalar loop on the same machines.
+//
+SIMD_TARGET("avx512f,avx512bw,avx512vbmi")
+static void
+HW_lutAVX512(const uchar *src, int n, const uchar *lut, uchar *dst)
+{
+	__m512i t0 = _mm512_loadu_si512(lut);
+	__m512i t1 = _mm512_loadu_si512(lut +  64);
+	__m512i t2 = _mm512_loadu_si512(lut + 128);
+	__m512i t3 = _mm512_loadu_si512(lut + 192);
+
+	for(int i=0; i<n; i+=64) {
+		__mmask64 k = (n - i >= 64) ? ~0ULL : (1ULL << (n - i)) - 1;
+		__m512i x  = _mm512_maskz_loadu_epi8(k, src + i);
+		__m512i lo = _mm512_permutex2var_epi8(t0, x, t1);	// lut[  0..127]
+		__m512i hi = _mm512_permutex2var_epi8(t2, x, t3);	// lut[128..255]
+		__m512i r  = _mm512_mask_blend_epi8(_mm512_movepi8_mask(x), lo, hi);
+		_mm512_mask_storeu_epi8(dst + i, k, r);
+	}
+}
+#endif	// SIMD_AVX512
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_lutSelect:
+//
+// Pick the fastest implementation supported by the CPU.
+//
+static HW_lutFn
+HW_lutSelect()
+{
+#ifdef SIMD_AVX512
+	int f = SIMD_features();
+	if(f & SIMD_AVX512VBMI) return HW_lutAVX512;
+#endif
+	return HW_lutScalar;
+}
+
+static std::once_flag	lutOnce;	// HW_lutSelect() runs once
+static HW_lutFn		lutFn;
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_LUT8:
+//
+// Apply 256-entry lookup table lut to n pixels of src.
+// Output is in dst, which may be the same as src.
+// All implementations give identical results.
+//
+void
+HW_LUT8(const uchar *src, int n, const uchar *lut, uchar *dst)
+{
+	HW_lutFn fn = SIMD_select(lutOnce, lutFn, HW_lutSelect);
+	fn(src, n, lut, dst);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_composeLut:
+//
+// Compose lookup tables: out[i] = b[a[i]], i.e. apply a, then b.
+// out may be the same as a or b.
+//
+void
+HW_composeLut(const uchar *a, const uchar *b, uchar *out)
+{
+	uchar tmp[MXGRAY];
+	for(int i=0; i<MXGRAY; i++) tmp[i] = b[a[i]];
+	memcpy(out, tmp, MXGRAY);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_applyLut:
+//
+// Apply lookup table lut to all channels of I1. Output is in I2, which
+// must already have the header of I1 (see IP_copyImageHeader).
+// Ranges of pixels are processed in parallel on the ThreadPool.
+//
+void
+HW_applyLut(ImagePtr I1, const uchar *lut, ImagePtr I2)
+{
+	int total = I1->width() * I1->height();
+
+	int type;
+	ChannelPtr<uchar> p1, p2;
+	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
+		IP_getChannel(I2, ch, p2, type);
+		const uchar *src = &p1[0];
+		uchar	    *dst = &p2[0];
+		ThreadPool::instance().parallel_for(0, total, 1<<18, [=](int lo, int hi) {
+			HW_LUT8(src + lo, hi - lo, lut, dst + lo);
+		});
+	}
+}
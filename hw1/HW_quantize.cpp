@@ -1,56 +1,251 @@
+#include "HW.h"
+#include "Simd.h"
+#include "ThreadPool.h"
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*HW_ditherFn)(const uchar*, int, int, unsigned int, int, int, uchar*);
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_hash:
+//
+// Mix the bits of x (lowbias32 integer hash). Hashing a counter gives
+// uniform random numbers that do not depend on evaluation order, so the
+// dither can run on any thread and in vector lanes.
+//
+static inline unsigned int
+HW_hash(unsigned int x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352d;
+	x ^= x >> 15;
+	x *= 0x846ca68b;
+	x ^= x >> 16;
+	return x;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_quantizeLut:
+//
+// Init lookup table lut to quantize to specified number of levels.
+//
+void
+HW_quantizeLut(int levels, uchar *lut)
+{
+	double scale = (double) MXGRAY / levels;
+	double bias  = scale / 2;
+	for(int i=0; i<MXGRAY; ++i)
+		lut[i] = (int) ((scale * (int) (i/scale)) + bias);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_ditherScalar:
+//
+// Add signed jitter to n pixels of src, starting at column x, and clip
+// to [0,MaxGray]. Output is in dst. Jitter magnitude is the top 16 bits
+// of HW_hash(key+x) scaled by bq/2^24, i.e. in [0,bias] for bq = 256*bias.
+// Sign alternates along the row, starting with -1 if s is even.
+//
+static void
+HW_ditherScalar(const uchar *src, int n, int x, unsigned int key, int s, int bq, uchar *dst)
+{
+	for(int i=0; i<n; i++, x++) {
+		int j = (int) ((HW_hash(key + x) >> 16) * bq >> 24);
+		int k = ((s + x) & 1) ? src[i] + j : src[i] - j;
+		dst[i] = CLIP(k, 0, MaxGray);
+	}
+}
+
+
+
+#ifdef SIMD_X86
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_ditherAVX2:
+//
+// HW_ditherScalar for 16 pixels at a time: two vectors of 8 hashes,
+// packed to bytes with saturating adds/subtracts. The tail is left to
+// the scalar version.
+//
+SIMD_TARGET("avx2")
+static void
+HW_ditherAVX2(const uchar *src, int n, int x, unsigned int key, int s, int bq, uchar *dst)
+{
+	const __m256i m1   = _mm256_set1_epi32(0x7feb352d);
+	const __m256i m2   = _mm256_set1_epi32((int) 0x846ca68b);
+	const __m256i b	   = _mm256_set1_epi32(bq);
+	const __m256i step = _mm256_set1_epi32(8);
+	__m256i c = _mm256_add_epi32(_mm256_set1_epi32(key + x),
+				     _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+	// byte lanes where the sign is +1: odd (s+x+i)
+	const __m128i plus = ((s + x) & 1) ? _mm_set1_epi16((short) 0x00ff)
+					   : _mm_set1_epi16((short) 0xff00);
+
+	int i;
+	for(i=0; i+16<=n; i+=16) {
+		__m256i h[2];
+		for(int v=0; v<2; v++) {
+			__m256i t = c;
+			t = _mm256_xor_si256(t, _mm256_srli_epi32(t, 16));
+			t = _mm256_mullo_epi32(t, m1);
+			t = _mm256_xor_si256(t, _mm256_srli_epi32(t, 15));
+			t = _mm256_mullo_epi32(t, m2);
+			t = _mm256_xor_si256(t, _mm256_srli_epi32(t, 16));
+			t = _mm256_srli_epi32(t, 16);
+			h[v] = _mm256_srli_epi32(_mm256_mullo_epi32(t, b), 24);
+			c = _mm256_add_epi32(c, step);
+		}
+
+		// jitter values fit in a byte: pack 16 of them in order
+		__m256i p = _mm256_packus_epi32(h[0], h[1]);
+		p = _mm256_permute4x64_epi64(p, 0xd8);
+		__m128i j = _mm_packus_epi16(_mm256_castsi256_si128(p),
+					     _mm256_extracti128_si256(p, 1));
+
+		__m128i in = _mm_loadu_si128((const __m128i*) (src + i));
+		__m128i jp = _mm_and_si128   (j, plus);
+		__m128i jm = _mm_andnot_si128(plus, j);
+		__m128i r  = _mm_subs_epu8(_mm_adds_epu8(in, jp), jm);
+		_mm_storeu_si128((__m128i*) (dst + i), r);
+	}
+	HW_ditherScalar(src + i, n - i, x + i, key, s, bq, dst + i);
+}
+
+
+
+#ifdef SIMD_AVX512
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_ditherAVX512:
+//
+// HW_ditherScalar for 64 pixels at a time: four vectors of 16 hashes,
+// narrowed to bytes with vpmovdb. The sign pattern is a byte mask and
+// the tail is handled with masked loads and stores.
+//
+SIMD_TARGET("avx512f,avx512bw")
+static void
+HW_ditherAVX512(const uchar *src, int n, int x, unsigned int key, int s, int bq, uchar *dst)
+{
+	const __m512i m1   = _mm512_set1_epi32(0x7feb352d);
+	const __m512i m2   = _mm512_set1_epi32((int) 0x846ca68b);
+	const __m512i b	   = _mm512_set1_epi32(bq);
+	const __m512i step = _mm512_set1_epi32(16);
+	__m512i c = _mm512_add_epi32(_mm512_set1_epi32(key + x),
+				     _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+						       8, 9,10,11,12,13,14,15));
+
+	// byte lanes where the sign is +1: odd (s+x+i)
+	const __mmask64 plus = ((s + x) & 1) ? 0x5555555555555555ULL
+					     : 0xaaaaaaaaaaaaaaaaULL;
+
+	for(int i=0; i<n; i+=64) {
+		__m512i t[4];
+		for(int v=0; v<4; v++) {
+			t[v] = c;
+			t[v] = _mm512_xor_si512(t[v], _mm512_srli_epi32(t[v], 16));
+			t[v] = _mm512_mullo_epi32(t[v], m1);
+			t[v] = _mm512_xor_si512(t[v], _mm512_srli_epi32(t[v], 15));
+			t[v] = _mm512_mullo_epi32(t[v], m2);
+			t[v] = _mm512_xor_si512(t[v], _mm512_srli_epi32(t[v], 16));
+			t[v] = _mm512_srli_epi32(t[v], 16);
+			t[v] = _mm512_srli_epi32(_mm512_mullo_epi32(t[v], b), 24);
+			c = _mm512_add_epi32(c, step);
+		}
+
+		// jitter values fit in a byte: narrow 64 of them in order
+		__m512i j = _mm512_castsi128_si512(_mm512_cvtepi32_epi8(t[0]));
+		j = _mm512_inserti32x4(j, _mm512_cvtepi32_epi8(t[1]), 1);
+		j = _mm512_inserti32x4(j, _mm512_cvtepi32_epi8(t[2]), 2);
+		j = _mm512_inserti32x4(j, _mm512_cvtepi32_epi8(t[3]), 3);
+
+		__mmask64 k  = (n - i >= 64) ? ~0ULL : (1ULL << (n - i)) - 1;
+		__m512i	  in = _mm512_maskz_loadu_epi8(k, src + i);
+		__m512i	  r  = _mm512_mask_adds_epu8(in, plus, in, j);
+		r = _mm512_mask_subs_epu8(r, ~plus, r, j);
+		_mm512_mask_storeu_epi8(dst + i, k, r);
+	}
+}
+#endif	// SIMD_AVX512
+#endif	// SIMD_X86
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_ditherSelect:
+//
+// Pick the fastest implementation supported by the CPU.
+//
+static HW_ditherFn
+HW_ditherSelect()
+{
+#ifdef SIMD_X86
+	int f = SIMD_features();
+#ifdef SIMD_AVX512
+	if(f & SIMD_AVX512BW) return HW_ditherAVX512;
+#endif
+	if(f & SIMD_AVX2    ) return HW_ditherAVX2;
+#endif
+	return HW_ditherScalar;
+}
+
+static std::once_flag	ditherOnce;	// HW_ditherSelect() runs once
+static HW_ditherFn	ditherSel;
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_quantize:
 //
 // Quantize I1 to specified number of levels. Apply dither if flag is set.
 // Output is in I2.
+// The dither is a function of (seed, channel, row, column) only, so the
+// output is the same for a given seed regardless of thread count.
 //
 void
-HW_quantize(ImagePtr I1, int levels, bool dither, ImagePtr I2)
+HW_quantize(ImagePtr I1, int levels, bool dither, ImagePtr I2, unsigned int seed)
 {
+	HW_ditherFn ditherFn = SIMD_select(ditherOnce, ditherSel, HW_ditherSelect);
+
 	IP_copyImageHeader(I1, I2);
 	int w = I1->width ();
 	int h = I1->height();
-	int total = w * h;
 
 	// init lookup table
-	double scale = (double) MXGRAY / levels;
-	double bias  = scale / 2;
-	int i, lut[MXGRAY];
-	for(i=0; i<MXGRAY; ++i)
-		lut[i] = (scale * (int) (i/scale)) + bias;
+	uchar lut[MXGRAY];
+	HW_quantizeLut(levels, lut);
 
 	if(!dither) {
 		// evaluate output: each input pixel indexes into lut[] to eval output
-		int type;
-		ChannelPtr<uchar> p1, p2, endd;
-		for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-			IP_getChannel(I2, ch, p2, type);
-			for(endd = p1 + total; p1<endd;) *p2++ = lut[*p1++];
-		}
-	} else {
-		int type, j, k, s;
-		ChannelPtr<uchar> p1, p2;
-		for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-			IP_getChannel(I2, ch, p2, type);
-			for(int y=0; y<h; y++) {
-				// first sign value alternates in each row
-				s = (y%2) ? 1 : -1;
-
-				// process all pixels in row, alternating sign value
-				for(int x=0; x<w; x++) {
-					// jitter is in [0,bias] range
-					j  = ((double) rand() / RAND_MAX) * bias;
-
-					// add signed jitter value
-					k  = *p1++ + j*s;
-
-					// alternate sign for next pixel
-					s *= -1;
-
-					// eval output using jittered value
-					*p2++ = lut[ CLIP(k, 0, MaxGray) ];
-				}
+		HW_applyLut(I1, lut, I2);
+		return;
+	}
+
+	// dither jitter is in [0,bias] range: half a quantization step,
+	// as 8.8 fixed point
+	int bq = (int) (256. * MXGRAY / levels / 2);
+
+	int type;
+	ChannelPtr<uchar> p1, p2;
+	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
+		IP_getChannel(I2, ch, p2, type);
+		const uchar *src = &p1[0];
+		uchar	    *dst = &p2[0];
+		unsigned int chkey = HW_hash(HW_hash(seed) + ch);
+		int grain = MAX((1<<16) / MAX(w, 1), 1);
+		ThreadPool::instance().parallel_for(0, h, grain, [=, &lut](int y0, int y1) {
+			for(int y=y0; y<y1; y++) {
+				// add signed jitter; first sign value alternates
+				// in each row
+				unsigned int key = HW_hash(chkey + y);
+				ditherFn(src + y*w, w, 0, key, y, bq, dst + y*w);
+
+				// eval output using jittered value
+				HW_LUT8(dst + y*w, w, lut, dst + y*w);
 			}
-		}
+		});
 	}
 }
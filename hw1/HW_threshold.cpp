@@ -1,3 +1,20 @@
+#include "HW.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_thresholdLut:
+//
+// Init lookup table lut for threshold thr.
+//
+void
+HW_thresholdLut(int thr, uchar *lut)
+{
+	int i;
+	for(i=0; i<thr && i<MXGRAY; ++i) lut[i] = 0;
+	for(   ;          i<MXGRAY; ++i) lut[i] = MaxGray;
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // HW_threshold:
 //
@@ -8,20 +25,11 @@ void
 HW_threshold(ImagePtr I1, int thr, ImagePtr I2)
 {
 	IP_copyImageHeader(I1, I2);
-	int w = I1->width ();
-	int h = I1->height();
-	int total = w * h;
 
 	// init lookup table
-	int i, lut[MXGRAY];
-	for(i=0; i<thr && i<MXGRAY; ++i) lut[i] = 0;
-	for(   ;          i<MXGRAY; ++i) lut[i] = MaxGray;
+	uchar lut[MXGRAY];
+	HW_thresholdLut(thr, lut);
 
 	// evaluate output: each input pixel indexes into lut[] to eval output
-	int type;
-	ChannelPtr<uchar> p1, p2, endd;
-	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
-		IP_getChannel(I2, ch, p2, type);
-		for(endd = p1 + total; p1<endd;) *p2++ = lut[*p1++];
-	}
+	HW_applyLut(I1, lut, I2);
 }
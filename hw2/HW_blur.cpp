@@ -1,46 +1,194 @@
+#include "HW.h"
+#include "Tiler.h"
+#include "ThreadPool.h"
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// HW_blur
+// HW_blurRecip:
 //
-// 
+// Fixed-point reciprocal of kernel width kw for HW_blurDiv().
+// (sum * recip) >> 32 == sum / kw exactly for sum <= MaxGray*kw when
+// kw < 4096.
 //
-void
-HW_BLUR1D(ChannelPtr<uchar> in, int len, int stride, int kernel_width, ChannelPtr<uchar> out) {
-	int buffer_size = len + ((kernel_width - 1 / 2) * 2);
-	uchar * buffer = new uchar[buffer_size];
-	uchar * temp = buffer;
-	int half_w = (kernel_width / 2);
+static inline unsigned long long
+HW_blurRecip(int kw)
+{
+	return ((1ULL << 32) + kw - 1) / kw;
+}
+
+static inline uchar
+HW_blurDiv(int sum, unsigned long long recip)
+{
+	return (uchar) ((sum * recip) >> 32);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_blurRow:
+//
+// Box filter len samples of in (spaced stride apart) with a kernel of
+// width kernel_width. Output is in out, with the same stride.
+// Borders are replicated. A running sum is updated by adding the sample
+// entering the window and subtracting the one leaving it, so the cost
+// per pixel is independent of kernel_width.
+// in and out must not overlap.
+//
+static void
+HW_blurRow(const uchar *in, int len, int stride, int kernel_width, uchar *out)
+{
+	int half_w = kernel_width / 2;
+	int last   = len - 1;
+	unsigned long long recip = HW_blurRecip(kernel_width);
+
+	// window for output i covers [i-half_w, i-half_w+kernel_width-1]
 	int sum = 0;
-	//if (kernel_width > len) return;
+	for(int j = -half_w; j < kernel_width - half_w; j++)
+		sum += in[CLIP(j, 0, last) * stride];
+
+	for(int i = 0; i < len; i++) {
+		out[i * stride] = HW_blurDiv(sum, recip);
 
-	for (int i = 0; i < half_w; i++){
-		*temp = *in;
-		temp++;
+		// slide window: add entering sample, subtract leaving sample
+		int add = MIN(i - half_w + kernel_width, last);
+		int sub = MAX(i - half_w, 0);
+		sum += in[add * stride] - in[sub * stride];
 	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_BLUR1D:
+//
+// Box filter len samples of in (spaced stride apart) with a kernel of
+// width kernel_width. Output is in out. See HW_blurRow().
+//
+void
+HW_BLUR1D(ChannelPtr<uchar> in, int len, int stride, int kernel_width, ChannelPtr<uchar> out)
+{
+	HW_blurRow(&in[0], len, stride, kernel_width, &out[0]);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_blurFill:
+//
+// Horizontally filter row y of the w-wide channel src into row.
+//
+static inline void
+HW_blurFill(const uchar *src, int w, int y, int xrow, uchar *row)
+{
+	if(xrow > 1) HW_blurRow(src + y * w, w, 1, xrow, row);
+	else	     memcpy(row, src + y * w, w);
+}
 
-	for (int i = 0; i < len; i++){
-		*temp = *in;
-		in += stride;
-		temp++;
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_blurChannel:
+//
+// Separable box filter of the w x h channel src with a kernel of size
+// xrow x ycol. Output rows [y0,y1) are written to dst.
+//
+// The horizontal pass is not stored in a full-size temp image. Instead,
+// horizontally filtered rows are kept in ring, a circular buffer of ycol
+// rows, and sum holds one running vertical sum per column. Moving down
+// one output row subtracts the ring row leaving the window, filters the
+// entering source row into the freed slot, and adds it back in.
+// Extra memory is O(ycol * w) and all accesses are row-contiguous.
+// Within one call, source row y-half+ycol is read only after output row
+// y is written, so src and dst may be the same channel if [y0,y1) is
+// the whole image.
+//
+static void
+HW_blurChannel(const uchar *src, int w, int h, int y0, int y1, int xrow, int ycol,
+	       uchar *ring, int *sum, uchar *dst)
+{
+	int half = ycol / 2;
+	int last = h - 1;
+	unsigned long long recip = HW_blurRecip(ycol);
+
+	// prime ring with rows [y0-half, y0-half+ycol-1] for output row y0;
+	// virtual row r lives in ring slot (r-y0+half) % ycol
+	for(int x = 0; x < w; x++) sum[x] = 0;
+	for(int j = 0; j < ycol; j++) {
+		uchar *row = ring + j * w;
+		HW_blurFill(src, w, CLIP(y0 + j - half, 0, last), xrow, row);
+		for(int x = 0; x < w; x++) sum[x] += row[x];
 	}
 
-	in -= stride;
+	for(int y = y0; y < y1; y++) {
+		uchar *orow = dst + y * w;
+		for(int x = 0; x < w; x++) orow[x] = HW_blurDiv(sum[x], recip);
+		if(y == y1 - 1) break;
 
-	for (int i = 0; i < half_w; i++){
-		*temp = *in;
-		temp++;
+		// row y-half leaves and row y-half+ycol enters: same slot
+		uchar *row = ring + ((y - y0) % ycol) * w;
+		for(int x = 0; x < w; x++) sum[x] -= row[x];
+		HW_blurFill(src, w, MIN(y - half + ycol, last), xrow, row);
+		for(int x = 0; x < w; x++) sum[x] += row[x];
 	}
+}
+
 
-	for (int pixel = 0; pixel < len; pixel++){
-		for (int j = 0; j < kernel_width; j++){
-			sum += buffer[pixel + j];
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_blur:
+//
+// Blur image I1 with a box filter (unweighted averaging).
+// The filter has width xrow and height ycol.
+// Output is in I2.
+//
+// The image is cut into full-width strips that are filtered in parallel
+// on the ThreadPool, each with its own ring buffer. A strip must be
+// primed with ycol rows, so strips are kept at least 2*ycol rows tall.
+//
+void
+HW_blur(ImagePtr I1, int xrow, int ycol, ImagePtr I2)
+{
+	IP_copyImageHeader(I1, I2);
+	int w = I1->width();
+	int h = I1->height();
+
+	//error check
+	if (xrow <= 1 && ycol <= 1){
+		if (I1 != I2){
+			IP_copyImage(I1, I2);
+		}
+		return;
+	}
+	if (xrow > w && ycol > h){
+		if (I1 != I2){
+			IP_copyImage(I1, I2);
 		}
-		sum = sum / kernel_width;
-		*out = sum;
-		out += stride;
-		sum = 0;
+		return;
 	}
+	xrow = MAX(xrow, 1);
+	ycol = MAX(ycol, 1);
 
-	delete[] buffer;
+	// strips read rows owned by their neighbors: filter from a copy
+	ImagePtr Isrc;
+	if(I1 == I2) IP_copyImage(I1, Isrc);
+	else	     Isrc = I1;
 
-}
+	Tiler tiler(w, h);
+	int th = (h + 4*ThreadPool::instance().threads() - 1) /
+		     (4*ThreadPool::instance().threads());
+	tiler.setTileSize(w, MAX(MAX(th, 2*ycol), 16));
 
+	int type;
+	ChannelPtr<uchar> p1, p2;
+	for (int ch = 0; IP_getChannel(Isrc, ch, p1, type); ch++) {
+		IP_getChannel(I2, ch, p2, type);
+		const uchar *src = &p1[0];
+		uchar	    *dst = &p2[0];
+		tiler.run([=](const Tile &t) {
+			// ring of ycol filtered rows and per-column sums
+			std::vector<uchar> ring(ycol * w);
+			std::vector<int>   sum(w);
+			HW_blurChannel(src, w, h, t.y0, t.y1, xrow, ycol,
+				       &ring[0], &sum[0], dst);
+		});
+	}
+}
@@ -1,93 +1,983 @@
+#include "HW.h"
+#include "Simd.h"
+#include "Tiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+#define CONV_EPS	1e-5	// L1 error of a plan, relative to the L1 norm of the kernel
+#define CONV_TOL	1e-6	// weights this close (relative to the largest) are folded
+#define CONV_PASS	2.0	// cost of storing and reloading one separable pass
+#define CONV_RANK	4	// most separable terms tried
+#define CONV_FFT_COST	1.25	// per w*h*log2(w*h) of an FFT tile, in multiply-adds
+#define CONV_FFT_MAX	512	// largest FFT tile side
+#define CONV_FIXED_COST	0.25	// per pair of fixed-point taps, with AVX2 or AVX-512
+#define CONV_SMALL_COST	0.3	// per tap of an unrolled 3x3 to 7x7 kernel
+#define CONV_SMALL_X	8	// outputs summed together by HW_convSmall()
+
+typedef void (*HW_convFixedFn)(const uchar*, const int*, const short*, int, int, int, uchar*);
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFold:
+//
+// Collect the taps of the ww x hh kernel k (odd dimensions) with
+// nonzero weight into t. Taps (x,y) and (-x,-y) about the center with
+// equal weights are paired as even taps, with opposite weights as odd
+// taps, so that a pair costs one multiply. Weights that differ (from
+// each other or from zero) by at most tol times the largest weight
+// count as equal; the caller checks the error.
+//
+static void
+HW_convFold(const double *k, int ww, int hh, double tol, HW_convTaps &t)
+{
+	int n = ww * hh;
+	double mx = 0;
+	for(int i=0; i<n; i++) mx = MAX(mx, fabs(k[i]));
+	tol *= mx;
+	std::vector<int>   x[3], y[3];		// even, odd and single taps
+	std::vector<float> w[3];
+	auto add = [&](int kind, int i, double wt) {
+		x[kind].push_back(i % ww - ww/2);
+		y[kind].push_back(i / ww - hh/2);
+		w[kind].push_back(wt);
+	};
+	for(int i=0; i<=n/2; i++) {
+		int    q = n-1 - i;			// tap (-x,-y)
+		double a = k[i];
+		double b = k[q];
+		if(q == i) {				// center
+			if(fabs(a) > tol) add(2, i, a);
+		} else if(fabs(a) > tol && fabs(a - b) <= tol) {
+			add(0, i, (a + b) / 2);
+		} else if(fabs(a) > tol && fabs(a + b) <= tol) {
+			add(1, i, (a - b) / 2);
+		} else {
+			if(fabs(a) > tol) add(2, i, a);
+			if(fabs(b) > tol) add(2, q, b);
+		}
+	}
+	t.x.clear();
+	t.y.clear();
+	t.w.clear();
+	for(int m=0; m<3; m++) {
+		t.x.insert(t.x.end(), x[m].begin(), x[m].end());
+		t.y.insert(t.y.end(), y[m].begin(), y[m].end());
+		t.w.insert(t.w.end(), w[m].begin(), w[m].end());
+	}
+	t.even = (int) w[0].size();
+	t.odd  = (int) w[1].size();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convUnfold:
+//
+// Add the weights of taps t into the ww x hh kernel k.
+//
+static void
+HW_convUnfold(const HW_convTaps &t, int ww, int hh, double *k)
+{
+	for(size_t i=0; i<t.w.size(); i++) {
+		int    j = (t.y[i] + hh/2)*ww + t.x[i] + ww/2;
+		double w = t.w[i];
+		k[j] += w;
+		if((int) i < t.even)		  k[ww*hh-1 - j] += w;
+		else if((int) i < t.even + t.odd) k[ww*hh-1 - j] -= w;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convError:
+//
+// True if the kernel applied by taps t differs from the ww x hh kernel
+// k by more than CONV_EPS of l1, the L1 norm of k.
+//
+static bool
+HW_convError(const HW_convTaps &t, const double *k, int ww, int hh, double l1)
+{
+	std::vector<double> kt(ww * hh, 0.);
+	HW_convUnfold(t, ww, hh, &kt[0]);
+	double err = 0;
+	for(int i=0; i<ww*hh; i++) err += fabs(kt[i] - k[i]);
+	return err > CONV_EPS * l1;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convCost:
+//
+// Estimated cost of taps t per output pixel, in multiply-adds:
+// a pair adds its two taps before the multiply.
+//
+static double
+HW_convCost(const HW_convTaps &t)
+{
+	return t.w.size() + .5 * (t.even + t.odd);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convTileFFT:
+//
+// Pick the FFT tile size tw x th (FFT_size() lengths up to
+// CONV_FFT_MAX) for overlap-save convolution with a ww x hh kernel:
+// every tile yields (tw-ww+1) x (th-hh+1) outputs for a forward and an
+// inverse transform. Return the estimated cost per output pixel in
+// multiply-adds, to compare with HW_convCost(). CONV_FFT_COST is
+// measured: it puts the crossover where the timings cross.
+//
+static double
+HW_convTileFFT(int ww, int hh, int &tw, int &th)
+{
+	double best = -1;
+	tw = th = 0;
+	for(int x=FFT_size(2*ww); x<=CONV_FFT_MAX; x=FFT_size(x+1)) {
+		for(int y=FFT_size(2*hh); y<=CONV_FFT_MAX; y=FFT_size(y+1)) {
+			double cost = 2 * CONV_FFT_COST * x * y * log2((double) x * y) /
+				      ((double) (x-ww+1) * (y-hh+1));
+			if(best < 0 || cost < best) {
+				best = cost;
+				tw   = x;
+				th   = y;
+			}
+		}
+	}
+	return best < 0 ? HUGE_VAL : best;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convQuantize:
+//
+// Quantize the nonzero taps of the ww x hh kernel k to 16-bit fixed
+// point f, with the largest shift for which the weights fit in a short
+// and no sum over uchar pixels overflows an int. Return false, leaving
+// f empty, if the quantization error could change a uchar output by a
+// gray level or more: 255 times the L1 error of the weights.
+//
+static bool
+HW_convQuantize(const double *k, int ww, int hh, HW_convFixed &f)
+{
+	f.x.clear();
+	f.y.clear();
+	f.w.clear();
+	f.shift = 0;
+
+	int    n = ww * hh;
+	double mx = 0, l1 = 0;
+	for(int i=0; i<n; i++) {
+		mx  = MAX(mx, fabs(k[i]));
+		l1 += fabs(k[i]);
+	}
+	if(mx == 0) return false;
+
+	int shift = (int) floor(log2(32767. / mx));
+	while(shift > 0 && (l1 * ldexp(1., shift) + n) * MaxGray >= 2147483647.)
+		shift--;
+	if(shift <= 0) return false;
+
+	double err = 0;
+	for(int i=0; i<n; i++) {
+		int q = (int) floor(ldexp(k[i], shift) + .5);
+		err += fabs(k[i] - ldexp((double) q, -shift));
+		if(!q) continue;
+		f.x.push_back(i % ww - ww/2);
+		f.y.push_back(i / ww - hh/2);
+		f.w.push_back(q);
+	}
+	if(err * MaxGray >= 1 || f.w.empty()) {
+		f.x.clear();
+		f.y.clear();
+		f.w.clear();
+		return false;
+	}
+	if(f.w.size() % 2) {			// pad to pairs
+		f.x.push_back(0);
+		f.y.push_back(0);
+		f.w.push_back(0);
+	}
+	f.shift = shift;
+	return true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convSVD:
+//
+// Singular value decomposition of the hh x ww kernel k by one-sided
+// Jacobi rotations: k = sum_j u_j v_j^T, where column u_j (hh values)
+// is scaled by singular value s_j and v_j (ww values) has unit length.
+// Terms are sorted by decreasing s_j, which is returned in s.
+//
+static void
+HW_convSVD(const double *k, int ww, int hh, std::vector<double> &u,
+	   std::vector<double> &v, std::vector<double> &s)
+{
+	// rotate pairs of columns of a = k until they are orthogonal;
+	// the rotations accumulate in v, so that k = a v^T throughout
+	std::vector<double> a(k, k + ww*hh);
+	std::vector<double> r(ww * ww, 0.);
+	for(int j=0; j<ww; j++) r[j*ww + j] = 1;
+	for(int sweep=0; sweep<60; sweep++) {
+		bool done = true;
+		for(int p=0; p<ww-1; p++) {
+			for(int q=p+1; q<ww; q++) {
+				double alpha = 0, beta = 0, gamma = 0;
+				for(int i=0; i<hh; i++) {
+					alpha += a[i*ww + p] * a[i*ww + p];
+					beta  += a[i*ww + q] * a[i*ww + q];
+					gamma += a[i*ww + p] * a[i*ww + q];
+				}
+				if(fabs(gamma) <= 1e-15 * sqrt(alpha * beta)) continue;
+				done = false;
+				double zeta = (beta - alpha) / (2 * gamma);
+				double t = (zeta >= 0 ? 1 : -1) / (fabs(zeta) + sqrt(1 + zeta*zeta));
+				double c = 1 / sqrt(1 + t*t);
+				double sn = c * t;
+				for(int i=0; i<hh; i++) {
+					double ap = a[i*ww + p], aq = a[i*ww + q];
+					a[i*ww + p] = c*ap - sn*aq;
+					a[i*ww + q] = sn*ap + c*aq;
+				}
+				for(int i=0; i<ww; i++) {
+					double rp = r[i*ww + p], rq = r[i*ww + q];
+					r[i*ww + p] = c*rp - sn*rq;
+					r[i*ww + q] = sn*rp + c*rq;
+				}
+			}
+		}
+		if(done) break;
+	}
+
+	// singular values are the norms of the columns of a
+	std::vector<int> order(ww);
+	std::vector<double> norm(ww, 0.);
+	for(int j=0; j<ww; j++) {
+		order[j] = j;
+		for(int i=0; i<hh; i++) norm[j] += a[i*ww + j] * a[i*ww + j];
+		norm[j] = sqrt(norm[j]);
+	}
+	std::sort(order.begin(), order.end(), [&](int i, int j) { return norm[i] > norm[j]; });
+
+	u.resize(ww * hh);
+	v.resize(ww * ww);
+	s.resize(ww);
+	for(int n=0; n<ww; n++) {
+		int j = order[n];
+		s[n]  = norm[j];
+		for(int i=0; i<hh; i++) u[n*hh + i] = a[i*ww + j];
+		for(int i=0; i<ww; i++) v[n*ww + i] = r[i*ww + j];
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convKernelInit:
+//
+// Analyze the first channel of kernel Ikernel and choose the cheapest
+// way to apply it with HW_convolveKernel():
+//	HW_CONV_TAPS:	   one pass over the nonzero taps, where taps
+//			   mirrored about the center with equal (or
+//			   opposite) weights share a multiply;
+//	HW_CONV_SEPARABLE: a sum of rank terms, each a horizontal and a
+//			   vertical 1-D pass, from the singular value
+//			   decomposition of the kernel. The 1-D passes skip
+//			   zeros and fold mirrored taps, too;
+//	HW_CONV_FFT:	   overlap-save FFT convolution of image tiles
+//			   with the kernel spectrum, which is kept in k;
+//	HW_CONV_SMALL:	   for kernels 3, 5 or 7 pixels wide and high, all
+//			   taps in loops unrolled for that size.
+// Rank-1 kernels (box, Gaussian, Sobel-like) cost ww+hh instead of
+// ww*hh multiply-adds per pixel; low-rank kernels cost rank times that.
+// The FFT costs about the same for any kernel size, so it is chosen for
+// large kernels that are neither sparse nor of low rank. Unrolled loops
+// beat the taps of dense small kernels and, up to about 5x5, even the
+// separable terms.
+// For uchar images, k.fixed also holds the taps in 16-bit fixed point
+// if that is within one gray level (HW_convQuantize()) and cheaper than
+// the plan; it is applied with vector multiply-adds of tap pairs.
+// A plan is only used if the kernel it applies differs from Ikernel by
+// at most CONV_EPS of its L1 norm.
+//
+void
+HW_convKernelInit(ImagePtr Ikernel, HW_convKernel &k)
+{
+	// cast kernel into array weight (of type float)
+	ImagePtr Iweights;
+	IP_castChannelsEq(Ikernel, FLOAT_TYPE, Iweights);
+	ChannelPtr<float> wts = Iweights[0];
+
+	int ww = k.ww = Ikernel->width ();
+	int hh = k.hh = Ikernel->height();
+	int n  = ww * hh;
+	k.wts.assign(&wts[0], &wts[0] + n);
+	std::vector<double> kd(k.wts.begin(), k.wts.end());
+	k.rows.clear();
+	k.cols.clear();
+	k.spectrum.clear();
+	k.fixed.w.clear();
+	k.plan = HW_CONV_TAPS;
+	if(!(ww % 2 && hh % 2)) return;		// rejected by HW_convolveKernel()
+
+	// nonzero taps, folded; exactly if folding within tolerance
+	// changed the kernel too much
+	double l1 = 0;
+	for(int i=0; i<n; i++) l1 += fabs(kd[i]);
+	HW_convFold(&kd[0], ww, hh, CONV_TOL, k.taps);
+	if(HW_convError(k.taps, &kd[0], ww, hh, l1))
+		HW_convFold(&kd[0], ww, hh, 0, k.taps);
+	double cost = HW_convCost(k.taps);
+
+	// separable terms from the SVD, as long as they are cheaper
+	std::vector<double> u, v, s, kr(n, 0.);
+	HW_convSVD(&kd[0], ww, hh, u, v, s);
+	std::vector<HW_convTaps> rows, cols;
+	double sep = 0;
+	for(int r=0; r<MIN(MIN(ww, hh), CONV_RANK) && s[r] > 0; r++) {
+		// balance the factors: u_r / sqrt(s_r) and v_r * sqrt(s_r)
+		std::vector<double> col(hh), row(ww);
+		for(int i=0; i<hh; i++) col[i] = u[r*hh + i] / sqrt(s[r]);
+		for(int i=0; i<ww; i++) row[i] = v[r*ww + i] * sqrt(s[r]);
+		HW_convTaps ct, rt;
+		HW_convFold(&col[0], 1, hh, CONV_TOL, ct);
+		HW_convFold(&row[0], ww, 1, CONV_TOL, rt);
+		sep += HW_convCost(rt) + HW_convCost(ct) + CONV_PASS;
+		if(sep >= cost) break;
+		rows.push_back(rt);
+		cols.push_back(ct);
+
+		// kernel applied by terms 0..r: sum of outer products
+		std::vector<double> c1(hh, 0.), r1(ww, 0.);
+		HW_convUnfold(ct, 1, hh, &c1[0]);
+		HW_convUnfold(rt, ww, 1, &r1[0]);
+		for(int i=0; i<hh; i++)
+			for(int j=0; j<ww; j++) kr[i*ww + j] += c1[i] * r1[j];
+		double err = 0;
+		for(int i=0; i<n; i++) err += fabs(kr[i] - kd[i]);
+		if(err <= CONV_EPS * l1) {
+			k.plan = HW_CONV_SEPARABLE;
+			k.rows = rows;
+			k.cols = cols;
+			cost   = sep;
+			break;
+		}
+	}
+
+	// overlap-save FFT, if cheaper than both; its cost hardly grows
+	// with the kernel size
+	double fft = HW_convTileFFT(ww, hh, k.fftW, k.fftH);
+	if(fft < cost) {
+		FFT2D fft2(k.fftW, k.fftH);
+		k.spectrum.resize(fft2.spectrumWidth() * k.fftH);
+		fft2.forward(&k.wts[0], ww, hh, ww, &k.spectrum[0]);
+		k.plan = HW_CONV_FFT;
+		cost   = fft;
+	}
+
+	// unrolled loops for the common small sizes
+	bool small = (ww == 3 || ww == 5 || ww == 7) && (hh == 3 || hh == 5 || hh == 7);
+	if(small && CONV_SMALL_COST * n < cost) {
+		k.plan = HW_CONV_SMALL;
+		cost   = CONV_SMALL_COST * n;
+	}
+
+	// fixed point for uchar images, if cheaper still; without vector
+	// multiply-adds it is no faster than the folded float taps
+	if(HW_convQuantize(&kd[0], ww, hh, k.fixed)) {
+		int    f     = SIMD_features();
+		double fixed = (f & (SIMD_AVX2 | SIMD_AVX512BW)) ?
+				CONV_FIXED_COST * k.fixed.w.size() / 2 : HUGE_VAL;
+		if(fixed >= cost) {
+			k.fixed.x.clear();
+			k.fixed.y.clear();
+			k.fixed.w.clear();
+		}
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convTapsRow:
+//
+// Add taps t applied to n consecutive pixels to acc. in points to the
+// first pixel and rows of in are stride apart. Each tap (or pair of
+// taps) runs over the whole row, which the compiler vectorizes.
+//
+template<class T>
+static void
+HW_convTapsRow(const T *in, int stride, const HW_convTaps &t, int n, float *acc)
+{
+	int i  = 0;
+	int nt = (int) t.w.size();
+	for(; i<t.even; i++) {
+		const T *a = in + t.y[i]*stride + t.x[i];
+		const T *b = in - t.y[i]*stride - t.x[i];
+		float	 w = t.w[i];
+		for(int x=0; x<n; x++) acc[x] += w * ((float) a[x] + b[x]);
+	}
+	for(; i<t.even+t.odd; i++) {
+		const T *a = in + t.y[i]*stride + t.x[i];
+		const T *b = in - t.y[i]*stride - t.x[i];
+		float	 w = t.w[i];
+		for(int x=0; x<n; x++) acc[x] += w * ((float) a[x] - b[x]);
+	}
+	for(; i<nt; i++) {
+		const T *a = in + t.y[i]*stride + t.x[i];
+		float	 w = t.w[i];
+		for(int x=0; x<n; x++) acc[x] += w * a[x];
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convSmall:
+//
+// Convolve tile t with the dense W x H kernel wts (W and H odd, known at
+// compile time); in, sw and out are as in HW_convTile(). Both tap loops
+// have constant bounds, so the compiler unrolls them and keeps the
+// weights in registers, and every sum is stored once rather than once
+// per tap. Blocks of CONV_SMALL_X outputs are summed together, so each
+// weight is loaded once per block.
+//
+template<int W, int H, class T, class Store>
+static void
+HW_convSmall(const T *in, int sw, const float *wts, const Tile &t, Store out)
+{
+	float k[H][W];
+	for(int j=0; j<H; j++)
+		for(int i=0; i<W; i++) k[j][i] = wts[j*W + i];
+
+	int tw = t.x1 - t.x0;
+	std::vector<float> acc(tw);
+	for(int y=t.y0; y<t.y1; y++, in += sw) {
+		const T *p = in - (H/2)*sw - W/2;	// top left tap of (x0,y)
+		int x;
+		for(x=0; x+CONV_SMALL_X<=tw; x+=CONV_SMALL_X) {
+			float sum[CONV_SMALL_X] = { 0 };
+			for(int j=0; j<H; j++)
+				for(int i=0; i<W; i++)
+					for(int b=0; b<CONV_SMALL_X; b++)
+						sum[b] += k[j][i] * p[j*sw + x+b + i];
+			for(int b=0; b<CONV_SMALL_X; b++) acc[x+b] = sum[b];
+		}
+		for(; x<tw; x++) {
+			float sum = 0;
+			for(int j=0; j<H; j++)
+				for(int i=0; i<W; i++) sum += k[j][i] * p[j*sw + x + i];
+			acc[x] = sum;
+		}
+		out(y, t.x0, tw, &acc[0]);
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convTile:
+//
+// Convolve tile t of the output with taps or separable terms of kernel
+// k. in points to the input pixel under the kernel center for output
+// pixel (t.x0,t.y0), with rows sw pixels apart; every pixel under the
+// kernel must be readable (see HW_convBorder()). out(y, x0, n, sum)
+// stores the n sums of output row y that start at column x0.
+//
+template<class T, class Store>
+static void
+HW_convTile(const T *in, int sw, const HW_convKernel &k, const Tile &t, Store out)
+{
+	int tw = t.x1 - t.x0;
+	int th = t.y1 - t.y0;
+
+	// unrolled loops for the sizes of HW_convKernelInit(); taps otherwise
+	if(k.plan == HW_CONV_SMALL) {
+		switch(k.ww*8 + k.hh) {
+#define SMALL(W,H) case W*8 + H: HW_convSmall<W,H>(in, sw, &k.wts[0], t, out); return;
+		SMALL(3,3) SMALL(3,5) SMALL(3,7)
+		SMALL(5,3) SMALL(5,5) SMALL(5,7)
+		SMALL(7,3) SMALL(7,5) SMALL(7,7)
+#undef SMALL
+		}
+	}
+	if(k.plan == HW_CONV_TAPS || k.plan == HW_CONV_SMALL) {
+		std::vector<float> acc(tw);
+		for(int y=0; y<th; y++) {			// visit rows
+			std::fill(acc.begin(), acc.end(), 0.f);
+			HW_convTapsRow(in + y*sw, sw, k.taps, tw, &acc[0]);
+			out(t.y0 + y, t.x0, tw, &acc[0]);
+		}
+		return;
+	}
+
+	// separable terms: horizontal pass over the th+hh-1 input rows of
+	// the tile into tmp, then vertical pass from tmp into acc
+	int r = k.hh / 2;
+	std::vector<float> tmp((th + 2*r) * tw), acc(th * tw, 0.f);
+	for(size_t n=0; n<k.rows.size(); n++) {
+		std::fill(tmp.begin(), tmp.end(), 0.f);
+		for(int y=0; y<th+2*r; y++)
+			HW_convTapsRow(in + (y-r)*sw, sw, k.rows[n], tw, &tmp[y*tw]);
+		for(int y=0; y<th; y++)
+			HW_convTapsRow(&tmp[(y+r)*tw], tw, k.cols[n], tw, &acc[y*tw]);
+	}
+	for(int y=0; y<th; y++) out(t.y0 + y, t.x0, tw, &acc[y*tw]);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convIndex:
+//
+// Index of the pixel that stands for index i of a row (or column) of n
+// pixels under border mode pad, or -1 for a zero border (CONSTANT):
+//	REPLICATE:  ... a a | a b c d | d d ...
+//	REFLECT:    ... c b | a b c d | c b ...	(edge pixel not repeated)
+//	WRAPAROUND: ... c d | a b c d | a b ...
+//
+static int
+HW_convIndex(int i, int n, int pad)
+{
+	if(i >= 0 && i < n) return i;
+	switch(pad) {
+	case CONSTANT:
+		return -1;
+	case REFLECT:
+		if(n == 1) return 0;
+		i %= 2*n - 2;
+		if(i < 0) i += 2*n - 2;
+		return (i < n) ? i : 2*n - 2 - i;
+	case WRAPAROUND:
+		i %= n;
+		return (i < 0) ? i + n : i;
+	default:			// REPLICATE
+		return CLIP(i, 0, n - 1);
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convBorder:
+//
+// Split tile t of the w x h output of a kernel of radius rx x ry into
+// its interior, where the kernel lies inside the image, and the strips
+// along the image border, and call fn(in, stride, r) on every part r,
+// as HW_convTile() expects. The interior is read from src (w x h) in
+// place, with no bounds checks. A strip is read from a copy of the
+// pixels under it: pixel (x,y) of the input grown by the radius is
+// src[ymap[y]*w + xmap[x]], or zero if either map is -1.
+//
+template<class T, class Fn>
+static void
+HW_convBorder(const T *src, int w, int h, const int *xmap, const int *ymap,
+	      int rx, int ry, const Tile &t, Fn fn)
+{
+	auto strip = [&](int x0, int y0, int x1, int y1) {
+		if(x0 >= x1 || y0 >= y1) return;
+		int bw = x1 - x0 + 2*rx;
+		int bh = y1 - y0 + 2*ry;
+		std::vector<T> buf(bw * bh);
+		for(int y=0; y<bh; y++) {
+			int sy = ymap[y0 + y];
+			for(int x=0; x<bw; x++) {
+				int sx = xmap[x0 + x];
+				buf[y*bw + x] = (sx < 0 || sy < 0) ? 0 : src[sy*w + sx];
+			}
+		}
+		Tile r = { x0, y0, x1, y1 };
+		fn(&buf[ry*bw + rx], bw, r);
+	};
+
+	// interior part of the tile
+	int x0 = MAX(t.x0, rx), x1 = MIN(t.x1, w - rx);
+	int y0 = MAX(t.y0, ry), y1 = MIN(t.y1, h - ry);
+	if(x0 >= x1 || y0 >= y1) {
+		strip(t.x0, t.y0, t.x1, t.y1);
+		return;
+	}
+	Tile r = { x0, y0, x1, y1 };
+	fn(src + y0*w + x0, w, r);
+
+	strip(t.x0, t.y0, t.x1, y0  );		// top
+	strip(t.x0, y1,	  t.x1, t.y1);		// bottom
+	strip(t.x0, y0,	  x0,	y1  );		// left
+	strip(x1,   y0,	  t.x1, y1  );		// right
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFFT:
+//
+// Convolve the w x h image src with kernel k by overlap-save FFT. The
+// input grown by the kernel radius (sw x sh) is read through xmap and
+// ymap, as in HW_convBorder(). Each tw x th tile of it is transformed,
+// multiplied by the conjugate spectrum of the kernel and transformed
+// back; the (tw-ww+1) x (th-hh+1) sums that did not wrap around are
+// stored with out(), as in HW_convTile(). Tiles run in parallel, each
+// with its own buffers, so memory is bounded by the tile size rather
+// than the image size.
+//
+template<class T, class Store>
+static void
+HW_convFFT(const T *src, int w, int h, const int *xmap, const int *ymap,
+	   const HW_convKernel &k, Store out)
+{
+	int sw = w + k.ww - 1;
+	int sh = h + k.hh - 1;
+
+	// tiles no larger than the padded image; the kernel spectrum is
+	// recomputed if that changes the size it was made for
+	int tw = MIN(k.fftW, FFT_size(sw));
+	int th = MIN(k.fftH, FFT_size(sh));
+	FFT2D fft(tw, th);
+	int   cn = fft.spectrumWidth() * th;
+	std::vector<FFT_complex> spec;
+	const FFT_complex *kspec = &k.spectrum[0];
+	if(tw != k.fftW || th != k.fftH) {
+		spec.resize(cn);
+		fft.forward(&k.wts[0], k.ww, k.hh, k.ww, &spec[0]);
+		kspec = &spec[0];
+	}
+
+	int    sx = tw - k.ww + 1;		// outputs per tile
+	int    sy = th - k.hh + 1;
+	int    kx = (w + sx-1) / sx;		// tiles across and down
+	int    ky = (h + sy-1) / sy;
+	double scale = 1. / ((double) tw * th);
+	ThreadPool::instance().run(kx*ky, [&](int i) {
+		int tx = (i % kx) * sx;
+		int ty = (i / kx) * sy;
+		int iw = MIN(tw, sw - tx);
+		int ih = MIN(th, sh - ty);
+		std::vector<float> in(iw * ih), row(sx);
+		for(int y=0; y<ih; y++) {
+			int sy = ymap[ty + y];
+			for(int x=0; x<iw; x++) {
+				int sx = xmap[tx + x];
+				in[y*iw + x] = (sx < 0 || sy < 0) ? 0 : src[sy*w + sx];
+			}
+		}
+
+		std::vector<FFT_complex> prod(cn);
+		std::vector<double>	 res(tw * th);
+		fft.forward(&in[0], iw, ih, iw, &prod[0]);
+		for(int j=0; j<cn; j++) {
+			FFT_complex a = prod[j], b = kspec[j];
+			prod[j] = FFT_complex(a.real()*b.real() + a.imag()*b.imag(),
+					      a.imag()*b.real() - a.real()*b.imag());
+		}
+		fft.inverse(&prod[0], &res[0]);
+
+		int nx = MIN(sx, w - tx);
+		int ny = MIN(sy, h - ty);
+		for(int y=0; y<ny; y++) {
+			for(int x=0; x<nx; x++) row[x] = res[y*tw + x] * scale;
+			out(ty + y, tx, nx, &row[0]);
+		}
+	});
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convChannel:
+//
+// Convolve the w x h channel src with kernel k by the plan of k. Borders
+// are read through xmap and ymap (see HW_convBorder()); the output is
+// stored with out(), as in HW_convTile().
+//
+template<class T, class Store>
+static void
+HW_convChannel(const T *src, int w, int h, const int *xmap, const int *ymap,
+	       const HW_convKernel &k, const Tiler &tiler, Store out)
+{
+	if(k.plan == HW_CONV_FFT) {
+		HW_convFFT(src, w, h, xmap, ymap, k, out);
+		return;
+	}
+	tiler.run([=, &k](const Tile &tile) {
+		HW_convBorder(src, w, h, xmap, ymap, k.ww/2, k.hh/2, tile,
+			      [&](const T *in, int stride, const Tile &r) {
+			HW_convTile(in, stride, k, r, out);
+		});
+	});
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-// HW_convolve
+// HW_convFixedScalar:
 //
+// Apply np pairs of fixed-point taps to n consecutive uchar pixels and
+// store the clipped results in dst. in points to the first pixel; tap j
+// reads in[off[j]] with weight w[j], and sums are shifted right by
+// shift. Sums cannot overflow (see HW_convQuantize()).
 //
+static void
+HW_convFixedScalar(const uchar *in, const int *off, const short *w, int np, int shift,
+		   int n, uchar *dst)
+{
+	for(int x=0; x<n; x++) {
+		int sum = 0;
+		for(int j=0; j<2*np; j++) sum += w[j] * in[off[j] + x];
+		sum >>= shift;
+		dst[x] = CLIP(sum, 0, MaxGray);
+	}
+}
+
+
+
+#ifdef SIMD_X86
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFixedAVX2:
+//
+// HW_convFixedScalar for 16 pixels at a time. The pixels of a pair of
+// taps are widened to 16 bits and interleaved, so that one vpmaddwd
+// multiplies both by their weights and adds them into 32-bit sums. The
+// sums are packed back to bytes with saturation, which clips them. The
+// tail is left to the scalar version.
+//
+SIMD_TARGET("avx2")
+static void
+HW_convFixedAVX2(const uchar *in, const int *off, const short *w, int np, int shift,
+		 int n, uchar *dst)
+{
+	int x;
+	for(x=0; x+16<=n; x+=16) {
+		__m256i lo = _mm256_setzero_si256();
+		__m256i hi = _mm256_setzero_si256();
+		for(int j=0; j<np; j++) {
+			__m256i a  = _mm256_cvtepu8_epi16(_mm_loadu_si128(
+					(const __m128i*) (in + off[2*j  ] + x)));
+			__m256i b  = _mm256_cvtepu8_epi16(_mm_loadu_si128(
+					(const __m128i*) (in + off[2*j+1] + x)));
+			__m256i wt = _mm256_set1_epi32((unsigned short) w[2*j] |
+						       ((unsigned short) w[2*j+1] << 16));
+			lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), wt));
+			hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), wt));
+		}
+
+		// unpack and pack work within 128-bit lanes: pixels come back in order
+		__m256i v = _mm256_packs_epi32(_mm256_srai_epi32(lo, shift),
+					       _mm256_srai_epi32(hi, shift));
+		__m128i r = _mm_packus_epi16(_mm256_castsi256_si128(v),
+					     _mm256_extracti128_si256(v, 1));
+		_mm_storeu_si128((__m128i*) (dst + x), r);
+	}
+	HW_convFixedScalar(in + x, off, w, np, shift, n - x, dst + x);
+}
+
+
+
+#ifdef SIMD_AVX512
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFixedAVX512:
+//
+// HW_convFixedAVX2 for 32 pixels at a time, narrowed to bytes with
+// vpmovuswb after clipping negative sums to zero.
+//
+SIMD_TARGET("avx512f,avx512bw")
+static void
+HW_convFixedAVX512(const uchar *in, const int *off, const short *w, int np, int shift,
+		   int n, uchar *dst)
+{
+	int x;
+	for(x=0; x+32<=n; x+=32) {
+		__m512i lo = _mm512_setzero_si512();
+		__m512i hi = _mm512_setzero_si512();
+		for(int j=0; j<np; j++) {
+			__m512i a  = _mm512_cvtepu8_epi16(_mm256_loadu_si256(
+					(const __m256i*) (in + off[2*j  ] + x)));
+			__m512i b  = _mm512_cvtepu8_epi16(_mm256_loadu_si256(
+					(const __m256i*) (in + off[2*j+1] + x)));
+			__m512i wt = _mm512_set1_epi32((unsigned short) w[2*j] |
+						       ((unsigned short) w[2*j+1] << 16));
+			lo = _mm512_add_epi32(lo, _mm512_madd_epi16(_mm512_unpacklo_epi16(a, b), wt));
+			hi = _mm512_add_epi32(hi, _mm512_madd_epi16(_mm512_unpackhi_epi16(a, b), wt));
+		}
+		__m512i v = _mm512_packs_epi32(_mm512_srai_epi32(lo, shift),
+					       _mm512_srai_epi32(hi, shift));
+		v = _mm512_max_epi16(v, _mm512_setzero_si512());
+		_mm256_storeu_si256((__m256i*) (dst + x), _mm512_cvtusepi16_epi8(v));
+	}
+	HW_convFixedScalar(in + x, off, w, np, shift, n - x, dst + x);
+}
+#endif	// SIMD_AVX512
+#endif	// SIMD_X86
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFixedSelect:
+//
+// Pick the fastest implementation supported by the CPU.
+//
+static HW_convFixedFn
+HW_convFixedSelect()
+{
+#ifdef SIMD_X86
+	int f = SIMD_features();
+#ifdef SIMD_AVX512
+	if(f & SIMD_AVX512BW) return HW_convFixedAVX512;
+#endif
+	if(f & SIMD_AVX2    ) return HW_convFixedAVX2;
+#endif
+	return HW_convFixedScalar;
+}
+
+static std::once_flag	fixedOnce;	// HW_convFixedSelect() runs once
+static HW_convFixedFn	fixedFn;
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convFixedTile:
+//
+// Convolve tile t of a uchar image with the fixed-point taps of kernel
+// k; in and sw are as in HW_convTile(). Output rows are w pixels apart
+// in dst.
+//
+static void
+HW_convFixedTile(const uchar *in, int sw, const HW_convKernel &k, const Tile &t,
+		 uchar *dst, int w)
+{
+	HW_convFixedFn fn = SIMD_select(fixedOnce, fixedFn, HW_convFixedSelect);
+
+	int np = (int) k.fixed.w.size() / 2;
+	std::vector<int> off(2*np);
+	for(int j=0; j<2*np; j++) off[j] = k.fixed.y[j]*sw + k.fixed.x[j];
+
+	int tw = t.x1 - t.x0;
+	for(int y=t.y0; y<t.y1; y++, in += sw)
+		fn(in, &off[0], &k.fixed.w[0], np, k.fixed.shift, tw, dst + y*w + t.x0);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convolveKernel:
+//
+// Convolve image I1 with kernel k, prepared by HW_convKernelInit().
+// Output is in I2. Pixels beyond the border are supplied by pad, one of
+// CONSTANT (zero), REPLICATE, REFLECT or WRAPAROUND (see HW_convIndex()).
+//
+// Tiles of the output are convolved in parallel. The image is not
+// padded: the interior of a tile is read in place and only its strips
+// along the image border are copied (see HW_convBorder()). Channels of
+// type uchar use the fixed-point taps of k, if it has any, instead of
+// its plan. Float channels are read and written in place.
 //
 void
-HW_convolve(ImagePtr I1, ImagePtr Ikernel, ImagePtr I2){
+HW_convolveKernel(ImagePtr I1, const HW_convKernel &k, ImagePtr I2, int pad)
+{
 	// kernel dimensions
-	int ww = Ikernel->width();
-	int hh = Ikernel->height();
+	int ww = k.ww;
+	int hh = k.hh;
 
 	// error checking: must use odd kernel dimensions
 	if (!(ww % 2 && hh % 2)) {
 		fprintf(stderr, "IP_convolve: kernel size must be odd\n");
 		return;
 	}
+	if (pad != CONSTANT && pad != REPLICATE && pad != REFLECT && pad != WRAPAROUND) {
+		fprintf(stderr, "IP_convolve: bad pad mode %d\n", pad);
+		return;
+	}
+
+	// tiles read pixels owned by their neighbors: filter from a copy
+	ImagePtr Isrc;
+	if (I1 == I2) IP_copyImage(I1, Isrc);
+	else	      Isrc = I1;
 
 	int w = I1->width();
 	int h = I1->height();
 	IP_copyImageHeader(I1, I2);
 
-	// clear offset; restore later
-	int xoffset = I1->xoffset();
-	int yoffset = I1->yoffset();
-	I1->setXOffset(0);
-	I1->setYOffset(0);
+	// source column (row) of every column (row) of the input grown by
+	// the kernel radius; -1 for zeros
+	std::vector<int> xmap(w + ww - 1), ymap(h + hh - 1);
+	for (int i = 0; i < w + ww - 1; i++) xmap[i] = HW_convIndex(i - ww/2, w, pad);
+	for (int i = 0; i < h + hh - 1; i++) ymap[i] = HW_convIndex(i - hh/2, h, pad);
+	const int *xm = &xmap[0], *ym = &ymap[0];
 
-	// pad image to handle border problems
-	int	 padnum[4];
-	ImagePtr Isrc;
-	padnum[0] = padnum[2] = ww / 2;		// left and right  padding
-	padnum[1] = padnum[3] = hh / 2;		// top  and bottom padding
-	IP_pad(I1, padnum, REPLICATE, Isrc);	// replicate border
-
-	// restore offsets
-	I1->setXOffset(xoffset);
-	I1->setYOffset(yoffset);
-
-	// cast kernel into array weight (of type float)
-	ImagePtr Iweights;
-	IP_castChannelsEq(Ikernel, FLOAT_TYPE, Iweights);
-	ChannelPtr<float> wts = Iweights[0];
+	Tiler tiler(w, h, MAX(ww, hh) / 2, I1->maxType() > UCHAR_TYPE ? sizeof(float) : 1);
 
+	int	 t;
 	ImagePtr I1f, I2f;
-	if (I1->maxType() > UCHAR_TYPE) {
-		I1f = IP_allocImage(w + ww - 1, h + hh - 1, FLOATCH_TYPE);
-		I2f = IP_allocImage(w, h, FLOATCH_TYPE);
-	}
-
-	int	t;
-	float	sum;
-	ChannelPtr<uchar> p1, p2, in, out;
-	ChannelPtr<float> f1, f2, wt;
+	ChannelPtr<uchar> p1, p2;
+	ChannelPtr<float> f1, f2;
 	for (int ch = 0; IP_getChannel(Isrc, ch, p1, t); ch++) {
 		IP_getChannel(I2, ch, p2, t);
+		if (t == UCHAR_TYPE && !k.fixed.w.empty()) {
+			const uchar *src = &p1[0];
+			uchar	    *dst = &p2[0];
+			tiler.run([=, &k](const Tile &tile) {
+				HW_convBorder(src, w, h, xm, ym, ww/2, hh/2, tile,
+					      [&](const uchar *in, int sw, const Tile &r) {
+					HW_convFixedTile(in, sw, k, r, dst, w);
+				});
+			});
+			continue;
+		}
 		if (t == UCHAR_TYPE) {
-			out = p2;
-			for (int y = 0; y<h; y++) {	// visit rows
-				for (int x = 0; x<w; x++) {	// slide window
-					sum = 0;
-					in = p1 + y*(w + ww - 1) + x;
-					wt = wts;
-					for (int i = 0; i<hh; i++) {	// convolution
-						for (int j = 0; j<ww; j++)
-							sum += (wt[j] * in[j]);
-						in += (w + ww - 1);
-						wt += ww;
-					}
-					*out++ = (int)(CLIP(sum, 0, MaxGray));
-				}
-			}
+			uchar *dst = &p2[0];
+			HW_convChannel(&p1[0], w, h, xm, ym, k, tiler,
+				       [=](int y, int x0, int n, const float *sum) {
+				uchar *out = dst + y*w + x0;
+				for (int x = 0; x<n; x++)
+					out[x] = (int)(CLIP(sum[x], 0, MaxGray));
+			});
 			continue;
 		}
-		IP_castChannel(Isrc, ch, I1f, 0, FLOAT_TYPE);
-		f2 = I2f[0];
-		for (int y = 0; y<h; y++) {		// visit rows
-			for (int x = 0; x<w; x++) {		// slide window
-				sum = 0;
-				f1 = I1f[0];
-				f1 += y*(w + ww - 1) + x;
-				wt = wts;
-				for (int i = 0; i<hh; i++) {	// convolution
-					for (int j = 0; j<ww; j++)
-						sum += (wt[j] * f1[j]);
-					f1 += (w + ww - 1);
-					wt += ww;
-				}
-				*f2++ = sum;
+
+		// other types are cast to float and back
+		if (t == FLOAT_TYPE) {
+			f1 = Isrc[ch];
+			f2 = I2[ch];
+		} else {
+			if (I1f.isNull()) {
+				I1f = IP_allocImage(w, h, FLOATCH_TYPE);
+				I2f = IP_allocImage(w, h, FLOATCH_TYPE);
 			}
+			IP_castChannel(Isrc, ch, I1f, 0, FLOAT_TYPE);
+			f1 = I1f[0];
+			f2 = I2f[0];
 		}
-		IP_castChannel(I2f, 0, I2, ch, t);
+		float *dst = &f2[0];
+		HW_convChannel(&f1[0], w, h, xm, ym, k, tiler,
+			       [=](int y, int x0, int n, const float *sum) {
+			memcpy(dst + y*w + x0, sum, n * sizeof(float));
+		});
+		if (t != FLOAT_TYPE) IP_castChannel(I2f, 0, I2, ch, t);
 	}
 }
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_convolve:
+//
+// Convolve image I1 with kernel Ikernel. Output is in I2. Borders are
+// handled by pad, as in HW_convolveKernel().
+// To apply one kernel to many images, analyze it once with
+// HW_convKernelInit() and call HW_convolveKernel().
+//
+void
+HW_convolve(ImagePtr I1, ImagePtr Ikernel, ImagePtr I2, int pad)
+{
+	HW_convKernel k;
+	HW_convKernelInit(Ikernel, k);
+	HW_convolveKernel(I1, k, I2, pad);
+}
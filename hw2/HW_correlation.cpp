@@ -1,4 +1,956 @@
+#include "HW.h"
+#include "IntegralImage.h"
+#include "Tiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+
 #define MAG(a, b)	(sqrt(a*a + b*b))
+#define CORR_FFT_COST	4.0	// per w*h*log2(w*h) of an FFT tile, in multiply-adds
+#define CORR_RADIUS	2	// refinement radius at each finer pyramid level
+#define CORR_SSD_MIN	64	// smallest template (in pixels) for pruned SSD
+#define CORR_SSD_SEED	64	// fraction of positions visited first by bound
+#define CORR_SSD_GAIN	0.25	// share of the direct SSD sums left after pruning
+
+// one template in a search: prepared data and the best match so far
+struct HW_corrJob {
+	std::vector<float> tmpl;	// mean-subtracted for CORR_COEFF, PHASE_CORR
+	int		ww, hh;		// template dimensions
+	double		tsq;		// sum of squares of tmpl
+	HW_corrTemplate *owner;		// holds the spectrum cache, or NULL
+	int		level;		// pyramid level of tmpl
+	int		x0, y0;		// origin of the search region in the image
+	int		nx, ny;		// positions in the search region
+	float		best;		// best score so far
+	int		dx, dy;		// and its position
+	bool		found;		// best was set by a search
+	int		topk;		// peaks to keep, or 0 for the best only
+	int		radius;		// suppression radius of a peak
+	float		thr;		// peaks must score at least (SSD: at most) thr
+	int		keep;		// candidate peaks kept per tile
+	std::vector<HW_corrMatch> peaks;// peaks found, for topk > 0
+};
+
+// position of an SSD search with its window norm and score bound
+struct HW_corrCand {
+	double	bound;			// lower bound of the score
+	double	norm;			// sqrt{sum{I^2}} of the window
+	int	x, y;
+};
+
+// best match (or peaks) found in one tile of the search window
+struct HW_corrBest {
+	float	val;
+	int	x, y;
+	bool	found;
+	std::vector<HW_corrMatch> peaks;// bounded heap, worst candidate on top
+};
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrJobInit:
+//
+// Prepare job j for the ww x hh float template p at pyramid level
+// level. The template is mean-subtracted for CORR_COEFF and PHASE_CORR;
+// avg is its mean if known, or negative to compute it.
+//
+static void
+HW_corrJobInit(int mtd, const float *p, int ww, int hh, int level, double avg,
+	       HW_corrTemplate *owner, HW_corrJob &j)
+{
+	int n = ww * hh;
+	j.tmpl.assign(p, p + n);
+	if(mtd == CORR_COEFF || mtd == PHASE_CORR) {
+		if(avg < 0) {
+			avg = 0;
+			for(int i=0; i<n; i++) avg += p[i];
+			avg /= n;
+		}
+		for(int i=0; i<n; i++) j.tmpl[i] -= avg;
+	}
+	j.tsq = 0;
+	for(int i=0; i<n; i++) j.tsq += (double) j.tmpl[i] * j.tmpl[i];
+	j.ww	= ww;
+	j.hh	= hh;
+	j.level = level;
+	j.owner = owner;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrScore:
+//
+// Score of job j at position (x,y) of the search region from its cross
+// term sum{T*I}; window sums of the region come from ii. Return false
+// where the score is undefined (flat window or template).
+//
+// With the window sums only the cross term is left to compute:
+//	SSD:	    sum{(T-I)^2} = sum{T^2} - 2 sum{T*I} + sum{I^2}
+//	CORR_COEFF: sum{(T-Tavg)(I-Iavg)} = sum{(T-Tavg)*I}, and
+//		    n sum{(I-Iavg)^2} = n sum{I^2} - sum{I}^2
+//
+static inline bool
+HW_corrScore(int mtd, double cross, const IntegralImage &ii, int x, int y,
+	     const HW_corrJob &j, double &corr)
+{
+	if(mtd == PHASE_CORR) {
+		corr = cross;
+		return true;
+	}
+	double e = ii.sumSq(0, x, y, x + j.ww, y + j.hh);
+	if(mtd == CORR_COEFF) {
+		int    n  = j.ww * j.hh;
+		double s  = ii.sum(0, x, y, x + j.ww, y + j.hh);
+		double vn = n*e - s*s;
+		if(vn <= 0 || j.tsq == 0) return false;
+		corr = cross / sqrt(j.tsq * vn / n);
+	} else {
+		if(e == 0) return false;
+		if(mtd == SSD) corr = MAX(j.tsq - 2*cross + e, 0.) / sqrt(e);
+		else	       corr = cross / sqrt(e);
+	}
+	return true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrUpdate:
+//
+// Keep corr at (x,y) in m if it beats the score in m
+// (SSD: smallest; other methods: largest).
+//
+static inline void
+HW_corrUpdate(int mtd, double corr, int x, int y, HW_corrBest &m)
+{
+	if(mtd == SSD ? corr < m.val : corr > m.val) {
+		m.val	= corr;
+		m.x	= x;
+		m.y	= y;
+		m.found = true;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrPeakBetter:
+//
+// True if peak a ranks before peak b: a better score, or an equal score
+// at an earlier raster position.
+//
+static inline bool
+HW_corrPeakBetter(int mtd, const HW_corrMatch &a, const HW_corrMatch &b)
+{
+	if(a.corr != b.corr) return (mtd == SSD) ? a.corr < b.corr : a.corr > b.corr;
+	return a.y < b.y || (a.y == b.y && a.x < b.x);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrPeakAdd:
+//
+// Offer corr at (x,y) to heap, the candidate peaks of job j found in one
+// tile: a heap of the j.keep best positions with the worst on top, so
+// that most positions are rejected by a single comparison once it is
+// full. Scores beyond j.thr are dropped. Nothing is suppressed here: a
+// position next to a better one may still be kept by the greedy
+// selection of HW_corrPeakSelect() once that one is suppressed itself.
+//
+static void
+HW_corrPeakAdd(int mtd, double corr, int x, int y, const HW_corrJob &j,
+	       std::vector<HW_corrMatch> &heap)
+{
+	HW_corrMatch c = { (float) corr, x, y };
+	if(mtd == SSD ? c.corr > j.thr : c.corr < j.thr) return;
+	if((int) heap.size() == j.keep && !HW_corrPeakBetter(mtd, c, heap[0])) return;
+
+	auto worse = [mtd](const HW_corrMatch &a, const HW_corrMatch &b) {
+		return HW_corrPeakBetter(mtd, a, b);
+	};
+	heap.push_back(c);
+	std::push_heap(heap.begin(), heap.end(), worse);
+	if((int) heap.size() > j.keep) {
+		std::pop_heap(heap.begin(), heap.end(), worse);
+		heap.pop_back();
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrPeakSelect:
+//
+// Greedy non-maximum suppression: sort peaks from best to worst, drop
+// every peak within radius (in x and in y) of a better peak that was
+// kept, and keep at most topk peaks.
+//
+static void
+HW_corrPeakSelect(int mtd, int topk, int radius, std::vector<HW_corrMatch> &peaks)
+{
+	std::sort(peaks.begin(), peaks.end(),
+		  [mtd](const HW_corrMatch &a, const HW_corrMatch &b) {
+			return HW_corrPeakBetter(mtd, a, b);
+		  });
+	int n = 0;
+	for(size_t i=0; i<peaks.size() && n<topk; i++) {
+		int k;
+		for(k=0; k<n; k++)
+			if(abs(peaks[k].x - peaks[i].x) <= radius &&
+			   abs(peaks[k].y - peaks[i].y) <= radius) break;
+		if(k == n) peaks[n++] = peaks[i];
+	}
+	peaks.resize(n);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrMerge:
+//
+// Merge the best match m of one tile of the search region into job j.
+// A better score wins and an earlier raster position breaks ties, so
+// the result does not depend on the order of the tiles. For top-k
+// searches the peaks of the tile are collected in j.peaks, to be
+// selected by HW_corrPeakSelect() once all tiles are merged.
+//
+static void
+HW_corrMerge(int mtd, const HW_corrBest &m, HW_corrJob &j)
+{
+	if(j.topk) {
+		for(size_t i=0; i<m.peaks.size(); i++) {
+			HW_corrMatch c = m.peaks[i];
+			c.x += j.x0;
+			c.y += j.y0;
+			j.peaks.push_back(c);
+		}
+		return;
+	}
+	if(!m.found) return;
+	int  x	    = j.x0 + m.x;
+	int  y	    = j.y0 + m.y;
+	bool better = (mtd == SSD) ? m.val < j.best : m.val > j.best;
+	bool tie    = (m.val == j.best) && (y < j.dy || (y == j.dy && x < j.dx));
+	if(better || tie) {
+		j.best	= m.val;
+		j.dx	= x;
+		j.dy	= y;
+		j.found = true;
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrTileFFT:
+//
+// Pick the FFT tile size tw x th for correlating a ww x hh template
+// over an sw x sh image by overlap-save: every tile yields
+// (tw-ww+1) x (th-hh+1) positions. Tile sizes are FFT_size() lengths
+// from the template up to the whole image. Return the estimated cost of
+// the best choice in multiply-adds, to compare with the direct sums.
+//
+static double
+HW_corrTileFFT(int sw, int sh, int ww, int hh, int &tw, int &th)
+{
+	int    nx = sw - ww + 1;
+	int    ny = sh - hh + 1;
+	double best = -1;
+	for(int x=FFT_size(ww); ; x=FFT_size(x+1)) {
+		for(int y=FFT_size(hh); ; y=FFT_size(y+1)) {
+			double tiles = (double) ((nx + x-ww) / (x-ww+1)) * ((ny + y-hh) / (y-hh+1));
+			double cost  = (tiles + 1) * CORR_FFT_COST * x * y * log2((double) x * y);
+			if(best < 0 || cost < best) {
+				best = cost;
+				tw   = x;
+				th   = y;
+			}
+			if(y >= sh) break;
+		}
+		if(x >= sw) break;
+	}
+	return best;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrSpectrum:
+//
+// Spectrum of the template of job j zero-padded to the size of fft.
+// It is kept in the owning HW_corrTemplate, so that searching frames of
+// the same size again reuses it; tmp holds it if there is no owner.
+//
+static const FFT_complex*
+HW_corrSpectrum(int mtd, const FFT2D &fft, const HW_corrJob &j,
+		std::vector<FFT_complex> &tmp)
+{
+	int key[4] = { fft.width(), fft.height(), j.level, mtd };
+	std::vector<FFT_complex> &spec = j.owner ? j.owner->spectrum : tmp;
+	if(j.owner && !memcmp(key, j.owner->spectrumKey, sizeof(key)) && !spec.empty())
+		return &spec[0];
+	spec.resize(fft.spectrumWidth() * fft.height());
+	fft.forward(&j.tmpl[0], j.ww, j.hh, j.ww, &spec[0]);
+	if(j.owner) memcpy(j.owner->spectrumKey, key, sizeof(key));
+	return &spec[0];
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrSearchFFT:
+//
+// Search the sw x sh region p (row stride ss) for the jobs in jobs by
+// overlap-save FFT correlation. The region is cut into overlapping
+// tw x th tiles sized for the largest template; every tile is
+// transformed once and, for each job, multiplied by the conjugate
+// spectrum of the zero-padded template and transformed back. The
+// positions that did not wrap around are scored right away, so no
+// full score map is ever stored.
+//
+// For PHASE_CORR the region is mean-subtracted, there is one tile, and
+// the cross-power spectrum is normalized to unit magnitude, so the
+// score is the phase correlation surface (a peak of 1 at a perfect
+// shift).
+//
+static void
+HW_corrSearchFFT(int mtd, const float *p, int sw, int sh, int ss,
+		 const IntegralImage &ii, std::vector<HW_corrJob*> &jobs)
+{
+	int nj	 = (int) jobs.size();
+	int wmax = 0, hmax = 0, nx = 0, ny = 0;
+	for(int k=0; k<nj; k++) {
+		wmax = MAX(wmax, jobs[k]->ww);
+		hmax = MAX(hmax, jobs[k]->hh);
+		nx   = MAX(nx,	 jobs[k]->nx);
+		ny   = MAX(ny,	 jobs[k]->ny);
+	}
+
+	int tw, th;
+	std::vector<float> zm;
+	if(mtd == PHASE_CORR) {
+		tw = FFT_size(sw);
+		th = FFT_size(sh);
+		double avg = 0;
+		for(int y=0; y<sh; y++)
+			for(int x=0; x<sw; x++) avg += p[y*ss + x];
+		avg /= (double) sw * sh;
+		zm.resize(sw * sh);
+		for(int y=0; y<sh; y++)
+			for(int x=0; x<sw; x++) zm[y*sw + x] = p[y*ss + x] - avg;
+		p  = &zm[0];
+		ss = sw;
+	} else	HW_corrTileFFT(sw, sh, wmax, hmax, tw, th);
+
+	int sx = tw - wmax + 1;		// positions per tile, for every job
+	int sy = th - hmax + 1;
+	if(mtd == PHASE_CORR) {		// one tile holds the whole region
+		sx = nx;
+		sy = ny;
+	}
+	int kx = (nx + sx-1) / sx;	// tiles across and down
+	int ky = (ny + sy-1) / sy;
+
+	FFT2D  fft(tw, th);
+	int    cn = fft.spectrumWidth() * th;
+	double scale = 1. / ((double) tw * th);
+	std::vector<std::vector<FFT_complex> > tmp(nj);
+	std::vector<const FFT_complex*> tspec(nj);
+	for(int k=0; k<nj; k++) tspec[k] = HW_corrSpectrum(mtd, fft, *jobs[k], tmp[k]);
+
+	std::vector<HW_corrBest> match(kx*ky*nj);
+	ThreadPool::instance().run(kx*ky, [&](int t) {
+		int tx = (t % kx) * sx;
+		int ty = (t / kx) * sy;
+		std::vector<FFT_complex> spec(cn), prod(cn);
+		std::vector<double>	 out(tw*th);
+		fft.forward(p + ty*ss + tx, MIN(tw, sw-tx), MIN(th, sh-ty), ss, &spec[0]);
+		for(int k=0; k<nj; k++) {
+			const HW_corrJob  &j = *jobs[k];
+			const FFT_complex *b = tspec[k];
+			for(int i=0; i<cn; i++) {
+				FFT_complex a = spec[i];
+				FFT_complex c(a.real()*b[i].real() + a.imag()*b[i].imag(),
+					      a.imag()*b[i].real() - a.real()*b[i].imag());
+				if(mtd == PHASE_CORR) {
+					double m = std::abs(c);
+					c = (m > 1e-9) ? c / m : FFT_complex(0);
+				}
+				prod[i] = c;
+			}
+			fft.inverse(&prod[0], &out[0]);
+
+			HW_corrBest &m = match[t*nj + k];
+			m.val	= j.best;
+			m.found = false;
+			for(int y=ty; y<ty+sy && y<j.ny; y++) {
+				for(int x=tx; x<tx+sx && x<j.nx; x++) {
+					double corr;
+					if(!HW_corrScore(mtd, out[(y-ty)*tw + x-tx] * scale, ii, x, y, j, corr))
+						continue;
+					if(j.topk) HW_corrPeakAdd(mtd, corr, x, y, j, m.peaks);
+					else	   HW_corrUpdate(mtd, corr, x, y, m);
+				}
+			}
+		}
+	});
+	for(int t=0; t<kx*ky; t++)
+		for(int k=0; k<nj; k++) HW_corrMerge(mtd, match[t*nj + k], *jobs[k]);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrSearchDirect:
+//
+// Search the region p (row stride ss) for job j by summing the cross
+// terms directly. The positions are split into tiles that run on the
+// ThreadPool.
+//
+static void
+HW_corrSearchDirect(int mtd, const float *p, int ss, const IntegralImage &ii, HW_corrJob &j)
+{
+	Tiler tiler(j.nx, j.ny, MAX(j.ww, j.hh), sizeof(float));
+	std::vector<HW_corrBest> match(tiler.tiles());
+
+	ThreadPool::instance().run(tiler.tiles(), [&](int k) {
+		Tile t = tiler.tile(k);
+		HW_corrBest &m = match[k];
+		m.val	= j.best;
+		m.found = false;
+		for(int y=t.y0; y<t.y1; y++) {			// visit rows
+		    for(int x=t.x0; x<t.x1; x++) {		// slide window
+			double cross = 0;
+			const float *image = p + y*ss + x;
+			const float *templ = &j.tmpl[0];
+			for(int i=0; i<j.hh; i++) {		// convolution
+				for(int jj=0; jj<j.ww; jj++)
+					cross += templ[jj] * image[jj];
+				image += ss;
+				templ += j.ww;
+			}
+
+			double corr;
+			if(!HW_corrScore(mtd, cross, ii, x, y, j, corr)) continue;
+			if(j.topk) HW_corrPeakAdd(mtd, corr, x, y, j, m.peaks);
+			else	   HW_corrUpdate(mtd, corr, x, y, m);
+		    }
+		}
+	});
+	for(size_t k=0; k<match.size(); k++) HW_corrMerge(mtd, match[k], j);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrSearchSSD:
+//
+// HW_corrSearchDirect() for SSD, with pruning that leaves the result
+// unchanged. The window sums give a lower bound of every score,
+//	sum{(T-I)^2} >= (sqrt{sum{T^2}} - sqrt{sum{I^2}})^2
+//	sum{(T-I)^2} >= (sum{T} - sum{I})^2 / n,
+// and positions whose bound exceeds the best score so far are skipped
+// (successive elimination). The squared differences of the others are
+// summed row by row, and a position is dropped as soon as the partial
+// sum makes it worse than the best score (partial distance
+// elimination). The best score is shared by all tiles.
+//
+// Both tests pay off once a good match is known, so the 1/CORR_SSD_SEED
+// of the positions of a tile with the lowest bounds are visited first,
+// in order of their bound; a full sort costs more than it saves. Top-k
+// searches keep the raster order and prune against the threshold or the
+// worst candidate of a full heap.
+//
+static void
+HW_corrSearchSSD(const float *p, int ss, const IntegralImage &ii, HW_corrJob &j)
+{
+	int    n  = j.ww * j.hh;
+	double ts = 0;
+	for(int i=0; i<n; i++) ts += j.tmpl[i];
+	double tn = sqrt(j.tsq);
+
+	Tiler tiler(j.nx, j.ny, MAX(j.ww, j.hh), sizeof(float));
+	std::vector<HW_corrBest> match(tiler.tiles());
+	std::atomic<float> shared(j.best);	// best score of all tiles so far
+
+	ThreadPool::instance().run(tiler.tiles(), [&](int k) {
+		Tile t = tiler.tile(k);
+		HW_corrBest &m = match[k];
+		m.val	= j.best;
+		m.found = false;
+
+		// window norms and score bounds; the bound is lowered a little
+		// so that rounding cannot push it above the score itself
+		std::vector<HW_corrCand> cand;
+		cand.reserve((t.x1 - t.x0) * (t.y1 - t.y0));
+		for(int y=t.y0; y<t.y1; y++) {
+			for(int x=t.x0; x<t.x1; x++) {
+				double e = ii.sumSq(0, x, y, x + j.ww, y + j.hh);
+				if(e == 0) continue;		// score undefined
+				double r = sqrt(e);
+				double a = tn - r;
+				double b = ts - ii.sum(0, x, y, x + j.ww, y + j.hh);
+				HW_corrCand c = { MAX(a*a, b*b/n) * (1 - 1e-6) / r, r, x, y };
+				cand.push_back(c);
+			}
+		}
+		if(!j.topk) {
+			auto lower = [](const HW_corrCand &a, const HW_corrCand &b) {
+				return a.bound < b.bound;
+			};
+			size_t q = cand.size() / CORR_SSD_SEED;
+			std::nth_element(cand.begin(), cand.begin() + q, cand.end(), lower);
+			std::sort(cand.begin(), cand.begin() + q, lower);
+		}
+		for(size_t ci=0; ci<cand.size(); ci++) {
+			const HW_corrCand &c = cand[ci];
+
+			// score to beat: positions scoring above it cannot win
+			float best = MIN(m.val, shared.load(std::memory_order_relaxed));
+			if(j.topk)
+				best = ((int) m.peaks.size() == j.keep) ? m.peaks[0].corr : j.thr;
+			if((float) c.bound > best) continue;
+
+			double lim = best * c.norm;
+			double d = 0;
+			const float *image = p + c.y*ss + c.x;
+			const float *templ = &j.tmpl[0];
+			int i;
+			for(i=0; i<j.hh; i++) {			// rows of template
+				for(int jj=0; jj<j.ww; jj++) {
+					double diff = (double) templ[jj] - image[jj];
+					d += diff * diff;
+				}
+				image += ss;
+				templ += j.ww;
+				if(d > lim && (float) (d / c.norm) > best) break;
+			}
+			if(i < j.hh) continue;			// eliminated
+
+			float corr = d / c.norm;
+			if(j.topk) {
+				HW_corrPeakAdd(SSD, corr, c.x, c.y, j, m.peaks);
+			} else if(corr < m.val || (m.found && corr == m.val &&
+				  (c.y < m.y || (c.y == m.y && c.x < m.x)))) {
+				m.val	= corr;
+				m.x	= c.x;
+				m.y	= c.y;
+				m.found = true;
+				float b = shared.load(std::memory_order_relaxed);
+				while(corr < b && !shared.compare_exchange_weak(b, corr));
+			}
+		}
+	});
+	for(size_t k=0; k<match.size(); k++) HW_corrMerge(SSD, match[k], j);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrSearch:
+//
+// Slide the templates of jobs over positions [x1,x2] x [y1,y2] of the
+// w x h float image p1 and update each job with its best score for
+// method mtd (CROSS_CORR, CORR_COEFF, PHASE_CORR: largest; SSD:
+// smallest) and its position. Only scores better than a job's incoming
+// best are accepted. All jobs share the search region, its integral
+// image and, for the FFT, the transforms of the image tiles.
+//
+// The cross terms of a job are summed directly, or by FFT when its
+// estimated cost is lower, which is the case for all but small
+// templates. PHASE_CORR always uses the FFT. Direct SSD sums are
+// pruned by HW_corrSearchSSD(), which is assumed to leave CORR_SSD_GAIN
+// of them to compute.
+//
+// The result is identical to a serial raster scan regardless of the
+// number of threads. Only raw pointers are used, so searches for
+// different templates may run concurrently.
+//
+static void
+HW_corrSearch(int mtd, const float *p1, int w, int h,
+	      int x1, int y1, int x2, int y2, std::vector<HW_corrJob*> &jobs)
+{
+	x1 = MAX(x1, 0);
+	y1 = MAX(y1, 0);
+	int wmax = 0, hmax = 0;
+	for(size_t k=0; k<jobs.size(); k++) {
+		wmax = MAX(wmax, jobs[k]->ww);
+		hmax = MAX(hmax, jobs[k]->hh);
+	}
+
+	// search region: the window plus the extent of the largest template
+	int sw = MIN(x2 + wmax, w) - x1;
+	int sh = MIN(y2 + hmax, h) - y1;
+	if(sw <= 0 || sh <= 0) return;
+	const float *p = p1 + y1*w + x1;
+
+	// integral image of the region; positions of every job
+	IntegralImage ii;
+	if(mtd != PHASE_CORR) ii.build(p, sw, sh, w, true);
+
+	std::vector<HW_corrJob*> fft;
+	for(size_t k=0; k<jobs.size(); k++) {
+		HW_corrJob &j = *jobs[k];
+		j.x0 = x1;
+		j.y0 = y1;
+		j.nx = MIN(x2 - x1, sw - j.ww) + 1;
+		j.ny = MIN(y2 - y1, sh - j.hh) + 1;
+		if(j.nx <= 0 || j.ny <= 0) continue;
+
+		// each peak kept by greedy selection suppresses at most
+		// (2r+1)^2-1 positions ranked before the next one, so the
+		// topk peaks are among the topk*(2r+1)^2 best positions
+		double keep = (double) j.topk * (2*j.radius + 1) * (2*j.radius + 1);
+		j.keep = (int) MIN(keep, (double) j.nx * j.ny);
+
+		int    tw, th;
+		bool   prune  = (mtd == SSD && j.ww*j.hh >= CORR_SSD_MIN);
+		double direct = (double) j.nx*j.ny*j.ww*j.hh * (prune ? CORR_SSD_GAIN : 1.);
+		if(mtd == PHASE_CORR || HW_corrTileFFT(sw, sh, j.ww, j.hh, tw, th) < direct)
+			fft.push_back(&j);
+		else if(prune)
+			HW_corrSearchSSD(p, w, ii, j);
+		else	HW_corrSearchDirect(mtd, p, w, ii, j);
+	}
+	if(!fft.empty()) HW_corrSearchFFT(mtd, p, sw, sh, w, ii, fft);
+
+	for(size_t k=0; k<jobs.size(); k++) {
+		HW_corrJob &j = *jobs[k];
+		if(j.topk) HW_corrPeakSelect(mtd, j.topk, j.radius, j.peaks);
+	}
+}
+
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrReduce:
+//
+// Next pyramid level of the float image I: blur with the 5-tap
+// binomial filter [1 4 6 4 1]/16 in x and y (borders replicated) and
+// keep every other pixel, so that pixel (x,y) of the result is centered
+// on pixel (2x,2y) of I. Rows run in parallel on the ThreadPool.
+//
+static ImagePtr
+HW_corrReduce(ImagePtr I)
+{
+	int w  = I->width ();
+	int h  = I->height();
+	int w2 = MAX(w/2, 1);
+	int h2 = MAX(h/2, 1);
+
+	int type;
+	ChannelPtr<float> c1, c2;
+	IP_getChannel(I, 0, c1, type);
+	ImagePtr I2 = IP_allocImage(w2, h2, FLOATCH_TYPE);
+	IP_getChannel(I2, 0, c2, type);
+	const float *src = &c1[0];
+	float	    *dst = &c2[0];
+
+	// horizontal pass on every row, at even columns only
+	std::vector<float> tmp(w2 * h);
+	float *t = &tmp[0];
+	ThreadPool::instance().parallel_for(0, h, 16, [=](int lo, int hi) {
+		for(int y=lo; y<hi; y++) {
+			const float *p = src + y*w;
+			for(int x=0; x<w2; x++) {
+				int x0 = 2*x;
+				float a = p[MAX(x0-2, 0)], b = p[MAX(x0-1, 0)];
+				float d = p[MIN(x0+1, w-1)], e = p[MIN(x0+2, w-1)];
+				t[y*w2 + x] = (a + 4*b + 6*p[x0] + 4*d + e) * (1.f/16);
+			}
+		}
+	});
+
+	// vertical pass at even rows
+	ThreadPool::instance().parallel_for(0, h2, 16, [=](int lo, int hi) {
+		for(int y=lo; y<hi; y++) {
+			int y0 = 2*y;
+			const float *a = t + MAX(y0-2, 0)*w2;
+			const float *b = t + MAX(y0-1, 0)*w2;
+			const float *c = t + y0*w2;
+			const float *d = t + MIN(y0+1, h-1)*w2;
+			const float *e = t + MIN(y0+2, h-1)*w2;
+			for(int x=0; x<w2; x++)
+				dst[y*w2 + x] = (a[x] + 4*b[x] + 6*c[x] + 4*d[x] + e[x]) * (1.f/16);
+		}
+	});
+	return I2;
+}
+
+
+
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_corrTemplateInit:
+//
+// Prepare template I2 for HW_correlationBatch(): cast its first channel
+// to float and cache its mean and energy (sum of squares). Reduced
+// pyramid levels and the template spectrum are added on first use and
+// kept, so a template prepared once can be matched against many images.
+//
+void
+HW_corrTemplateInit(ImagePtr I2, HW_corrTemplate &t)
+{
+	// cast template into buffer of type float
+	ImagePtr II2;
+	if(I2->channelType(0) != FLOAT_TYPE) {
+		II2 = IP_allocImage(I2->width(), I2->height(), FLOATCH_TYPE);
+		IP_castChannel(I2, 0, II2, 0, FLOAT_TYPE);
+	} else	II2 = I2;
+	t.pyramid.assign(1, II2);
+
+	int type;
+	ChannelPtr<float> p;
+	IP_getChannel(II2, 0, p, type);
+	int total = I2->width() * I2->height();
+	t.mean	 = 0;
+	t.energy = 0;
+	for(int i=0; i<total; i++) {
+		t.mean	 += p[i];
+		t.energy += (double) p[i] * p[i];
+	}
+	t.mean /= total;
+
+	t.spectrum.clear();
+	memset(t.spectrumKey, 0, sizeof(t.spectrumKey));
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_correlationPeaks:
+//
+// Find up to kmax peaks of every template of tmpl in image I1 with method
+// mtd: peaks[k] receives the best matches of template k from best to
+// worst, no two of them within radius pixels (in x and in y) of each
+// other, and none scoring below thr (SSD: above) on the normalized
+// scale of HW_correlation(). Templates that do not fit in I1 get no
+// peaks. The templates must be distinct objects.
+//
+// Peaks are collected while the scores are computed: each tile of a
+// search keeps a bounded heap of its kmax*(2*radius+1)^2 best positions,
+// which hold every peak that greedy non-maximum suppression of the full
+// score map would keep. The heaps are merged and suppressed greedily, so
+// the peaks are those of the score map but it is never stored. With
+// multires, 2*kmax peaks are taken on the top level of the pyramid and
+// each is refined like the single best match; the final selection is
+// made on the base level.
+//
+// With kmax=0 only the single best match is kept, without threshold or
+// suppression, as HW_correlationBatch() returns it.
+//
+// Work on the image is done once for all templates: the cast to float,
+// the pyramid, and for every exhaustive search the integral image and
+// the FFT of each image tile, whose spectrum is then multiplied by the
+// spectra of all templates searched at that pyramid level. The
+// coarse-to-fine refinements of the templates run in parallel.
+//
+void
+HW_correlationPeaks(ImagePtr I1, std::vector<HW_corrTemplate> &tmpl, int mtd,
+		    int multires, int kmax, int radius, float thr,
+		    std::vector<std::vector<HW_corrMatch> > &peaks)
+{
+	int nt = (int) tmpl.size();
+	peaks.assign(nt, std::vector<HW_corrMatch>());
+	int topk = MAX(kmax, 0);
+	radius	 = MAX(radius, 0);
+
+	// smallest template (in pixels) at the top of the pyramid
+	int lowres = 0;
+	switch(mtd) {
+	case CROSS_CORR:
+	case SSD:
+	case CORR_COEFF:
+		lowres = 64;
+		break;
+	case PHASE_CORR:
+		lowres = 1024;		// whitened spectrum needs more pixels
+		break;
+	default:
+		fprintf(stderr, "Correlation: Bad mtd %d\n", mtd);
+		return;
+	}
+
+	// image dimensions
+	int w = I1->width ();
+	int h = I1->height();
+
+	// top pyramid level of every template: halve until the template
+	// would have fewer than lowres pixels; -1 if it does not fit
+	std::vector<int> top(nt, -1);
+	int mxlevel = 0;
+	for(int k=0; k<nt; k++) {
+		HW_corrTemplate &t = tmpl[k];
+		int ww = t.pyramid[0]->width ();
+		int hh = t.pyramid[0]->height();
+
+		// error checking: size of image I1 must be >= than template
+		if(!(ww<=w && hh<=h)) {
+			fprintf(stderr, "Correlation: image is smaller than template\n");
+			continue;
+		}
+		int n = 0;
+		while(multires && n < 7 && (ww>>(n+1)) * (hh>>(n+1)) >= lowres) n++;
+		while((int) t.pyramid.size() <= n)
+			t.pyramid.push_back(HW_corrReduce(t.pyramid.back()));
+		top[k]	= n;
+		mxlevel = MAX(mxlevel, n);
+	}
+
+	// cast image into buffer of type float and build its pyramid
+	ImagePtr pyramid1[8];
+	if(I1->channelType(0) != FLOAT_TYPE) {
+		pyramid1[0] = IP_allocImage(w, h, FLOATCH_TYPE);
+		IP_castChannel(I1, 0, pyramid1[0], 0, FLOAT_TYPE);
+	} else	pyramid1[0] = I1;
+	for(int n=1; n<=mxlevel; n++) pyramid1[n] = HW_corrReduce(pyramid1[n-1]);
+
+	// raw pointers to all levels, for use from the ThreadPool
+	int type;
+	const float *p1[8];
+	int	     w1[8], h1[8];
+	for(int n=0; n<=mxlevel; n++) {
+		ChannelPtr<float> p;
+		IP_getChannel(pyramid1[n], 0, p, type);
+		p1[n] = &p[0];
+		w1[n] = pyramid1[n]->width ();
+		h1[n] = pyramid1[n]->height();
+	}
+	std::vector<const float*> p2(nt * 8);
+	std::vector<int>	  w2(nt * 8), h2(nt * 8);
+	for(int k=0; k<nt; k++) {
+		for(int n=0; n<=top[k]; n++) {
+			ChannelPtr<float> p;
+			IP_getChannel(tmpl[k].pyramid[n], 0, p, type);
+			p2[k*8 + n] = &p[0];
+			w2[k*8 + n] = tmpl[k].pyramid[n]->width ();
+			h2[k*8 + n] = tmpl[k].pyramid[n]->height();
+		}
+	}
+
+	// initial score: below (above, for SSD) any match
+	float init = (mtd == SSD) ? 10000000. : (mtd == CROSS_CORR) ? 0. : -2.;
+
+	// scale of the scores of every template: CROSS_CORR and SSD are
+	// normalized by the template energy last; no threshold on the peaks
+	// of upper pyramid levels
+	std::vector<double> norm(nt, 1.);
+	if(mtd == CROSS_CORR || mtd == SSD)
+		for(int k=0; k<nt; k++) norm[k] = sqrt(tmpl[k].energy);
+	double any = (mtd == SSD) ? HUGE_VAL : -HUGE_VAL;
+
+	// exhaustive search at the top of the pyramid, one search for all
+	// templates that share a top level
+	std::vector<HW_corrJob> job(nt);
+	for(int n=mxlevel; n>=0; n--) {
+		std::vector<HW_corrJob*> jobs;
+		for(int k=0; k<nt; k++) {
+			if(top[k] != n) continue;
+			HW_corrJob &j = job[k];
+			HW_corrJobInit(mtd, p2[k*8 + n], w2[k*8 + n], h2[k*8 + n], n,
+				       n ? -1 : tmpl[k].mean, &tmpl[k], j);
+			j.best	 = init;
+			j.dx	 = j.dy = 0;
+			j.found	 = false;
+			j.topk	 = (topk && n) ? 2*topk : topk;
+			j.radius = radius >> n;
+			j.thr	 = n ? any : thr * norm[k];
+			j.peaks.clear();
+			jobs.push_back(&j);
+		}
+		if(!jobs.empty())
+			HW_corrSearch(mtd, p1[n], w1[n], h1[n], 0, 0, w1[n], h1[n], jobs);
+	}
+
+	// multiresolution correlation: use results of lower-res correlation
+	// (at the top of the pyramid) to narrow the search in the higher-res
+	// correlation (towards the base of the pyramid). Every finer level
+	// searches CORR_RADIUS pixels around twice the position found on the
+	// level above; top-k searches refine each peak of the top level that
+	// way. Templates are refined in parallel.
+	ThreadPool::instance().run(nt, [&](int k) {
+		if(top[k] < 0) return;
+		HW_corrJob &j = job[k];
+		std::vector<HW_corrMatch> &cand = peaks[k];
+		if(topk) {
+			cand.swap(j.peaks);
+		} else {
+			HW_corrMatch c = { j.best, j.dx, j.dy };
+			cand.assign(1, c);
+		}
+		for(int n=top[k]-1; n>=0; n--) {
+			HW_corrJobInit(mtd, p2[k*8 + n], w2[k*8 + n], h2[k*8 + n], n,
+				       n ? -1 : tmpl[k].mean, NULL, j);
+			j.topk = 0;
+			size_t m = 0;
+			for(size_t i=0; i<cand.size(); i++) {
+				HW_corrMatch &c = cand[i];
+				int x1 = 2*c.x - CORR_RADIUS;
+				int y1 = 2*c.y - CORR_RADIUS;
+				int x2 = 2*c.x + CORR_RADIUS;
+				int y2 = 2*c.y + CORR_RADIUS;
+				j.best	= init;
+				j.dx	= c.x;
+				j.dy	= c.y;
+				j.found = false;
+				std::vector<HW_corrJob*> jobs(1, &j);
+				HW_corrSearch(mtd, p1[n], w1[n], h1[n], x1, y1, x2, y2, jobs);
+				if(topk && !j.found) continue;	// no defined score
+				HW_corrMatch r = { j.best, j.dx, j.dy };
+				cand[m++] = r;
+			}
+			cand.resize(m);
+		}
+
+		// threshold and suppress the refined peaks on the base level
+		if(topk && top[k]) {
+			size_t m = 0;
+			for(size_t i=0; i<cand.size(); i++) {
+				float t = thr * norm[k];
+				if(mtd == SSD ? cand[i].corr <= t : cand[i].corr >= t)
+					cand[m++] = cand[i];
+			}
+			cand.resize(m);
+			HW_corrPeakSelect(mtd, topk, radius, cand);
+		}
+
+		// normalize final correlation values
+		for(size_t i=0; i<cand.size(); i++) cand[i].corr /= norm[k];
+	});
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_correlationBatch:
+//
+// Match every template of tmpl against image I1 with method mtd, as
+// HW_correlation() does for one template; match[k] receives the
+// correlation number and offset of template k. Templates that do not
+// fit in I1 get a zero match. The templates must be distinct objects.
+// See HW_correlationPeaks() for the work shared between templates.
+//
+void
+HW_correlationBatch(ImagePtr I1, std::vector<HW_corrTemplate> &tmpl, int mtd,
+		    int multires, std::vector<HW_corrMatch> &match)
+{
+	std::vector<std::vector<HW_corrMatch> > peaks;
+	HW_correlationPeaks(I1, tmpl, mtd, multires, 0, 0, 0., peaks);
+
+	HW_corrMatch none = { 0., 0, 0 };
+	match.assign(tmpl.size(), none);
+	for(size_t k=0; k<peaks.size(); k++)
+		if(!peaks[k].empty()) match[k] = peaks[k][0];
+}
+
+
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // IP_correlation:
 //
@@ -72,175 +1024,12 @@
 float
 HW_correlation(ImagePtr I1, ImagePtr I2, int mtd, int multires, int &xx, int &yy)
 {
-	// init vars to suppress compiler warnings
-	int	  dx = 0;
-	int	  dy = 0;
-	int   lowres = 0;
-	float	mag  = 0;
-	float	corr = 0;
-	double	xsz, ysz;
-
-	// image dimensions
-	int w = I1->width ();
-	int h = I1->height();
-
-	// template dimensions
-	int ww = I2->width ();
-	int hh = I2->height();
-
-	// error checking: size of image I1 must be >= than template I2
-	if(!(ww<=w && hh<=h)) {
-		fprintf(stderr, "Correlation: image is smaller than template\n");
-		return 0.;
-	}
-
-	// cast image into buffer of type float
-	ImagePtr II1;
-	if(I1->channelType(0) != FLOAT_TYPE) {
-		II1 = IP_allocImage(I1->width(), I1->height(), FLOATCH_TYPE);
-		IP_castChannel(I1, 0, II1, 0, FLOAT_TYPE);
-	} else	II1 = I1;
-
-	// cast template into buffer of type float
-	ImagePtr II2;
-	if(I2->channelType(0) != FLOAT_TYPE) {
-		II2 = IP_allocImage(I2->width(), I2->height(), FLOATCH_TYPE);
-		IP_castChannel(I2, 0, II2, 0, FLOAT_TYPE);
-	} else	II2 = I2;
-
-	// create image and template pyramids with original images at base;
-	// if no multiresolution is used, pyramids consist of only one level.
-	int mxlevel;
-	ImagePtr pyramid1[8], pyramid2[8];
-	pyramid1[0] = II1;		// base: original image
-	pyramid2[0] = II2;		// base: original template
-	if(multires) {
-		switch(mtd) {
-		case CROSS_CORR:
-		case SSD:
-			lowres = 64;
-			break;
-		}
-	} else	mxlevel = 0;
-
-	// init search window
-	int x1 = 0;
-	int y1 = 0;
-	int x2 = (w-ww)>>mxlevel;
-	int y2 = (h-hh)>>mxlevel;
-
-	// declarations
-	int		  total;
-	float		  sum1, sum2, avg, tmpl_pow;
-	ChannelPtr<float> image, templ;
-	ImagePtr	  Iblur, Ifft1, Ifft2;
-
-	// multiresolution correlation: use results of lower-res correlation
-	// (at the top of the pyramid) to narrow the search in the higher-res
-	// correlation (towards the base of the pyramid).
-	for(int n=mxlevel; n>=0; n--) {
-	    // init vars based on pyramid at level n
-	    w  = pyramid1[n]->width(); h  = pyramid1[n]->height();
-	    ww = pyramid2[n]->width(); hh = pyramid2[n]->height();
-
-	    // pointers to image and template data
-	    ChannelPtr<float> p1 = pyramid1[n][0];	// image    ptr
-	    ChannelPtr<float> p2 = pyramid2[n][0];	// template ptr
-
-	    // init min and max
-	    float min = 10000000.;
-	    float max = 0.;
-
-	    switch(mtd) {
-	    case CROSS_CORR:				// cross correlation
-		for(int y=y1; y<=y2; y++) {		// visit rows
-		    for(int x=x1; x<=x2; x++) {		// slide window
-			sum1  = sum2 = 0;
-			image = p1 + y*w + x;
-			templ = p2;
-			for(int i=0; i<hh; i++) {	// convolution
-		   		for(int j=0; j<ww; j++) {
-					sum1 += (templ[j] * image[j]);
-					sum2 += (image[j] * image[j]);
-				}
-				image += w;
-				templ += ww;
-			}
-			if(sum2 == 0) continue;
-
-			corr = sum1 / sqrt(sum2);
-			if(corr > max) {
-		   		max = corr;
-		   		dx  = x;
-		   		dy  = y;
-			}
-		    }
-		}
-
-		// update search window or normalize final correlation value
-		if(n) {		// set search window for next pyramid level
-			x1 = MAX(0,   2*dx - n);
-			y1 = MAX(0,   2*dy - n);
-			x2 = MIN(2*w, 2*dx + n);
-			y2 = MIN(2*h, 2*dy + n);
-		} else {	// normalize correlation value at final level
-			tmpl_pow = 0;
-			total	 = ww * hh;
-			for(int i=0; i<total; i++)
-				tmpl_pow += (p2[i] * p2[i]);
-			corr =	max / sqrt(tmpl_pow);
-		}
-		break;
-
-	    case SSD:				// sum of squared differences
-		float diff;
-		for(int y=y1; y<=y2; y++) {		// visit rows
-		    for(int x=x1; x<=x2; x++) {		// slide window
-			sum1  = sum2 = 0;
-			image = p1 + y*w + x;
-			templ = p2;
-			for(int i=0; i<hh; i++) {	// convolution
-		   		for(int j=0; j<ww; j++) {
-					diff  = templ[j] - image[j];
-					sum1 += (diff * diff);
-					sum2 += (image[j] * image[j]);
-				}
-				image += w;
-				templ += ww;
-			}
-			if(sum2 == 0) continue;
-
-			corr = sum1 / sqrt(sum2);
-			if(corr < min) {
-		   		min = corr;
-		   		dx  = x;
-		   		dy  = y;
-			}
-		     }
-		}
-
-		// update search window or normalize final correlation value
-		if(n) {		// set search window for next pyramid level
-			x1 = MAX(0,   2*dx - n);
-			y1 = MAX(0,   2*dy - n);
-			x2 = MIN(2*w, 2*dx + n);
-			y2 = MIN(2*h, 2*dy + n);
-		} else {	// normalize correlation value at final level
-			total = ww * hh;
-			float	tmpl_pow = 0;
-			for(int i=0; i<total; i++)
-				tmpl_pow += (p2[i] * p2[i]);
-			corr =	min / sqrt(tmpl_pow);
-		}
-		break;
-
-	    default:
-		fprintf(stderr, "Correlation: Bad mtd %d\n", mtd);
-		return 0.;
-	    }
-	}
+	std::vector<HW_corrTemplate> tmpl(1);
+	std::vector<HW_corrMatch>    match;
+	HW_corrTemplateInit(I2, tmpl[0]);
+	HW_correlationBatch(I1, tmpl, mtd, multires, match);
 
-	xx = dx;
-	yy = dy;
-	return corr;
+	xx = match[0].x;
+	yy = match[0].y;
+	return match[0].corr;
 }
@@ -0,0 +1,96 @@
+#include "HW.h"
+#include <cmath>
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_iteratePass:
+//
+// Apply k iterations of stencil fn (radius r) to I1. Output is in I2,
+// which must not be I1.
+// Each tile of the output is computed from a tile-local copy of the
+// input grown by k*r pixels, which runs through all k iterations while
+// it is in cache, ping-ponging between two tile-local buffers. Iteration
+// j only computes the tile grown by (k-j)*r, the region that the later
+// iterations still read.
+//
+static void
+HW_iteratePass(ImagePtr I1, int k, int r, const HW_stencilFn &fn, ImagePtr I2)
+{
+	int w = I1->width ();
+	int h = I1->height();
+	int H = k * r;				// halo of the first iteration
+	Tiler tiler(w, h, H, 2);
+
+	int type;
+	ChannelPtr<uchar> p1, p2;
+	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
+		IP_getChannel(I2, ch, p2, type);
+		const uchar *src = &p1[0];
+		uchar	    *dst = &p2[0];
+		tiler.run([=, &fn](const Tile &t) {
+			// tile grown by the halo, clamped to the image
+			int x0 = MAX(t.x0 - H, 0), x1 = MIN(t.x1 + H, w);
+			int y0 = MAX(t.y0 - H, 0), y1 = MIN(t.y1 + H, h);
+			int lw = x1 - x0;
+			int lh = y1 - y0;
+
+			std::vector<uchar> a(lw * lh), b(lw * lh);
+			for(int y = y0; y < y1; y++)
+				memcpy(&a[(y - y0) * lw], src + y * w + x0, lw);
+
+			for(int j = 1; j <= k; j++) {
+				int  g = (k - j) * r;
+				Tile v;
+				v.x0 = MAX(t.x0 - g, 0) - x0;
+				v.y0 = MAX(t.y0 - g, 0) - y0;
+				v.x1 = MIN(t.x1 + g, w) - x0;
+				v.y1 = MIN(t.y1 + g, h) - y0;
+				fn(&a[0], lw, lh, v, &b[0]);
+				a.swap(b);
+			}
+
+			for(int y = t.y0; y < t.y1; y++)
+				memcpy(dst + y * w + t.x0,
+				       &a[(y - y0) * lw + (t.x0 - x0)], t.x1 - t.x0);
+		});
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_iterate:
+//
+// Apply itrs iterations of stencil fn with radius r to I1, using
+// temporal blocking. Output is in I2.
+//
+// fn(src, w, h, t, dst) filters the w x h buffer src over tile t into
+// the same pixels of dst, reading only within r pixels of t and
+// replicating the border of src. The result is the same as running fn
+// over the whole image itrs times, but each tile does several
+// iterations at once, so the image streams through memory once per
+// pass rather than once per iteration. Iterations per pass are limited
+// so that the recomputed halo stays small next to a cache-sized tile.
+//
+void
+HW_iterate(ImagePtr I1, int itrs, int r, const HW_stencilFn &fn, ImagePtr I2)
+{
+	IP_copyImageHeader(I1, I2);
+
+	// iterations per pass: halo at most 1/8 of the tile side
+	int side  = (int) sqrt(TILE_CACHE_BYTES / 2.);
+	int depth = CLIP(side / (8 * MAX(r, 1)), 1, MAX(itrs, 1));
+
+	ImagePtr Isrc = I1;
+	ImagePtr Itmp[2];
+	for(int done = 0, pass = 0; done < itrs; pass++) {
+		int k = MIN(depth, itrs - done);
+		done += k;
+
+		// last pass writes I2 directly unless it is also the input
+		ImagePtr Idst = (done == itrs && Isrc != I2) ? I2 : Itmp[pass & 1];
+		IP_copyImageHeader(Isrc, Idst);
+		HW_iteratePass(Isrc, k, r, fn, Idst);
+		Isrc = Idst;
+	}
+	if(Isrc != I2) IP_copyImage(Isrc, I2);
+}
@@ -0,0 +1,427 @@
+#include "HW.h"
+#include "Simd.h"
+#include "Tiler.h"
+#include "ThreadPool.h"
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*HW_medianFn)(const uchar *const*, int, int, int, uchar *const*, uchar*);
+
+// Sorting networks over lanes of any width, written in terms of macros
+// VMIN/VMAX (lane-wise min/max) and CE(a,b) (compare-exchange: a gets
+// the min, b the max) that each implementation defines for its lanes.
+#define SORT3(a,b,c)		CE(a,b) CE(b,c) CE(a,b)
+#define SORT5(a,b,c,d,e)	CE(a,d) CE(b,e) CE(a,c) CE(b,d) CE(a,b)\
+				CE(c,e) CE(b,c) CE(d,e) CE(c,d)
+#define MED3(a,b,c)		VMAX(VMIN(a,b), VMIN(VMAX(a,b),c))
+
+// ----------------------------------------------------------------------
+// median of 3x3 or 5x5 windows for one row, N pixels per step.
+// r[0..sz-1] are the rows of the window, padded to m = n+sz-1 columns.
+// Each column is sorted vertically into S[0..sz-1] (S[0] is the min),
+// where it is shared by the sz windows that overlap it.
+// 3x3: the median is the median of the max of the column mins, the
+// median of the column medians, and the min of the column maxes.
+// 5x5: sorting the 5 sorted columns across makes the window sorted in
+// both directions. Element (i,j) is then above (i+1)(j+1)-1 others and
+// below (5-i)(5-j)-1 others, which rules out all but 13 candidates,
+// with 6 known to be smaller and 6 larger. Their median is found by
+// forgetful selection: starting with 8 of them, repeatedly drop the min
+// and max and add the next one, until 3 are left.
+//
+#define HW_MEDIAN_NET(V, N, LOAD, STORE)\
+	if(sz == 3) {\
+		for(int i=0; i<m; i+=N) {\
+			V a = LOAD(r[0]+i), b = LOAD(r[1]+i), c = LOAD(r[2]+i);\
+			SORT3(a, b, c);\
+			STORE(S[0]+i, a); STORE(S[1]+i, b); STORE(S[2]+i, c);\
+		}\
+		for(int i=0; i<n; i+=N) {\
+			V l0 = LOAD(S[0]+i), l1 = LOAD(S[0]+i+1), l2 = LOAD(S[0]+i+2);\
+			V m0 = LOAD(S[1]+i), m1 = LOAD(S[1]+i+1), m2 = LOAD(S[1]+i+2);\
+			V h0 = LOAD(S[2]+i), h1 = LOAD(S[2]+i+1), h2 = LOAD(S[2]+i+2);\
+			V lo = VMAX(VMAX(l0, l1), l2);\
+			V md = MED3(m0, m1, m2);\
+			V hi = VMIN(VMIN(h0, h1), h2);\
+			STORE(dst+i, MED3(lo, md, hi));\
+		}\
+	} else {\
+		for(int i=0; i<m; i+=N) {\
+			V a = LOAD(r[0]+i), b = LOAD(r[1]+i), c = LOAD(r[2]+i);\
+			V d = LOAD(r[3]+i), e = LOAD(r[4]+i);\
+			SORT5(a, b, c, d, e);\
+			STORE(S[0]+i, a); STORE(S[1]+i, b); STORE(S[2]+i, c);\
+			STORE(S[3]+i, d); STORE(S[4]+i, e);\
+		}\
+		for(int i=0; i<n; i+=N) {\
+			V v[5][5];\
+			for(int k=0; k<5; k++)\
+				for(int j=0; j<5; j++) v[k][j] = LOAD(S[k]+i+j);\
+			SORT5(v[0][0], v[0][1], v[0][2], v[0][3], v[0][4]);\
+			SORT5(v[1][0], v[1][1], v[1][2], v[1][3], v[1][4]);\
+			SORT5(v[2][0], v[2][1], v[2][2], v[2][3], v[2][4]);\
+			SORT5(v[3][0], v[3][1], v[3][2], v[3][3], v[3][4]);\
+			SORT5(v[4][0], v[4][1], v[4][2], v[4][3], v[4][4]);\
+			V e0  = v[0][3], e1  = v[0][4], e2  = v[1][2], e3  = v[1][3];\
+			V e4  = v[1][4], e5  = v[2][1], e6  = v[2][2], e7  = v[2][3];\
+			V e8  = v[3][0], e9  = v[3][1], e10 = v[3][2], e11 = v[4][0];\
+			V e12 = v[4][1];\
+			CE(e0, e1) CE(e2, e3) CE(e4, e5) CE(e6, e7)\
+			CE(e0, e2) CE(e0, e4) CE(e0, e6)	/* drop e0, e7  */\
+			CE(e1, e7) CE(e3, e7) CE(e5, e7)\
+			CE(e1, e2) CE(e3, e4) CE(e5, e6)\
+			CE(e1, e3) CE(e1, e5) CE(e1, e8)	/* drop e1, e6  */\
+			CE(e2, e6) CE(e4, e6) CE(e8, e6)\
+			CE(e2, e3) CE(e4, e5) CE(e8, e9)\
+			CE(e2, e4) CE(e2, e8)			/* drop e2, e9  */\
+			CE(e3, e9) CE(e5, e9)\
+			CE(e3, e4) CE(e5, e8)\
+			CE(e3, e5) CE(e3, e10)			/* drop e3, e8  */\
+			CE(e4, e8) CE(e10, e8)\
+			CE(e4, e5) CE(e10, e11)\
+			CE(e4, e10) CE(e5, e11)			/* drop e4, e11 */\
+			STORE(dst+i, MED3(e5, e10, e12));\
+		}\
+	}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianNetScalar:
+//
+// Reference implementation of HW_MEDIAN_NET, one pixel at a time.
+//
+#define VMIN(a,b)	MIN(a,b)
+#define VMAX(a,b)	MAX(a,b)
+#define CE(a,b)		{ int t_ = VMIN(a,b); b = VMAX(a,b); a = t_; }
+#define LOAD(p)		(*(p))
+#define STORE(p,v)	(*(p) = (v))
+static void
+HW_medianNetScalar(const uchar *const *r, int sz, int m, int n, uchar *const *S, uchar *dst)
+{
+	HW_MEDIAN_NET(int, 1, LOAD, STORE)
+}
+#undef VMIN
+#undef VMAX
+#undef CE
+#undef LOAD
+#undef STORE
+
+
+
+#ifdef SIMD_X86
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianNetAVX2:
+//
+// HW_MEDIAN_NET for 32 pixels at a time.
+//
+#define VMIN(a,b)	_mm256_min_epu8(a,b)
+#define VMAX(a,b)	_mm256_max_epu8(a,b)
+#define CE(a,b)		{ __m256i t_ = VMIN(a,b); b = VMAX(a,b); a = t_; }
+#define LOAD(p)		_mm256_loadu_si256((const __m256i*) (p))
+#define STORE(p,v)	_mm256_storeu_si256((__m256i*) (p), v)
+SIMD_TARGET("avx2")
+static void
+HW_medianNetAVX2(const uchar *const *r, int sz, int m, int n, uchar *const *S, uchar *dst)
+{
+	HW_MEDIAN_NET(__m256i, 32, LOAD, STORE)
+}
+#undef VMIN
+#undef VMAX
+#undef CE
+#undef LOAD
+#undef STORE
+
+
+
+#ifdef SIMD_AVX512
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianNetAVX512:
+//
+// HW_MEDIAN_NET for 64 pixels at a time.
+//
+#define VMIN(a,b)	_mm512_min_epu8(a,b)
+#define VMAX(a,b)	_mm512_max_epu8(a,b)
+#define CE(a,b)		{ __m512i t_ = VMIN(a,b); b = VMAX(a,b); a = t_; }
+#define LOAD(p)		_mm512_loadu_si512((const void*) (p))
+#define STORE(p,v)	_mm512_storeu_si512((void*) (p), v)
+SIMD_TARGET("avx512f,avx512bw")
+static void
+HW_medianNetAVX512(const uchar *const *r, int sz, int m, int n, uchar *const *S, uchar *dst)
+{
+	HW_MEDIAN_NET(__m512i, 64, LOAD, STORE)
+}
+#undef VMIN
+#undef VMAX
+#undef CE
+#undef LOAD
+#undef STORE
+#endif	// SIMD_AVX512
+#endif	// SIMD_X86
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianNetSelect:
+//
+// Pick the fastest implementation supported by the CPU.
+//
+static HW_medianFn
+HW_medianNetSelect()
+{
+#ifdef SIMD_X86
+	int f = SIMD_features();
+#ifdef SIMD_AVX512
+	if(f & SIMD_AVX512BW) return HW_medianNetAVX512;
+#endif
+	if(f & SIMD_AVX2    ) return HW_medianNetAVX2;
+#endif
+	return HW_medianNetScalar;
+}
+
+static std::once_flag	medianOnce;	// HW_medianNetSelect() runs once
+static HW_medianFn	medianFn;
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianPad:
+//
+// Copy m pixels of row src (width w), starting at column x0, into dst.
+// Columns outside the image replicate the border.
+//
+static void
+HW_medianPad(const uchar *src, int w, int x0, int m, uchar *dst)
+{
+	int a = CLIP(-x0,    0, m);		// columns left of the image
+	int b = CLIP(w - x0, a, m);		// end of columns inside it
+	memset(dst,	src[0],	     a);
+	memcpy(dst + a, src + x0 + a, b - a);
+	memset(dst + b, src[w-1],    m - b);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianNet:
+//
+// Median filter src (w x h) with a 3x3 or 5x5 window over tile t.
+// Output is in dst. Sorting networks compute 32 or 64 medians at once
+// with byte min/max instructions. The rows of the window, padded with
+// the replicated border, are kept in a ring of sz buffers, so each
+// input row is copied once. Buffers are rounded up so that the vector
+// loops need no tail.
+//
+static void
+HW_medianNet(const uchar *src, int w, int h, int sz, const Tile &t, uchar *dst)
+{
+	HW_medianFn fn = SIMD_select(medianOnce, medianFn, HW_medianNetSelect);
+
+	int half   = sz / 2;
+	int n	   = t.x1 - t.x0;		// output columns
+	int m	   = n + sz - 1;		// input columns
+	int stride = ((m + 63) & ~63) + 64;	// room for vector overrun
+
+	// ring of padded rows, sorted columns, output row
+	std::vector<uchar> buf((2*sz + 1) * stride, 0);
+	uchar *ring = &buf[0];
+	uchar *S[5], *out = &buf[2*sz*stride];
+	const uchar *r[5];
+	for(int k = 0; k < sz; k++) S[k] = &buf[(sz + k) * stride];
+
+	for(int y = t.y0; y < t.y1; y++) {
+		// add row y+half to the ring (all rows of the first window)
+		for(int v = (y == t.y0) ? y - half : y + half; v <= y + half; v++)
+			HW_medianPad(src + CLIP(v, 0, h - 1) * w, w, t.x0 - half, m,
+				     ring + ((v + sz*h) % sz) * stride);
+		for(int k = 0; k < sz; k++)
+			r[k] = ring + ((y - half + k + sz*h) % sz) * stride;
+
+		fn(r, sz, m, n, S, out);
+		memcpy(dst + y * w + t.x0, out, n);
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_medianHisto:
+//
+// Median filter src (w x h) with an sz x sz window over tile t.
+// Output is in dst. Constant time per pixel (Perreault and Hebert):
+// every column under the tile keeps a histogram of its sz pixels, with
+// 16 coarse bins (high nibble) and 256 fine bins. Moving down a row
+// updates each column histogram with one removal and one addition.
+// Moving right along a row updates the window's coarse histogram with
+// one column added and one removed; the coarse bins locate the 16-bin
+// segment holding the median, and only that fine segment of the window
+// histogram is brought up to date, lazily, from the columns passed
+// since it was last used.
+//
+static void
+HW_medianHisto(const uchar *src, int w, int h, int sz, const Tile &t, uchar *dst)
+{
+	int half = sz / 2;
+	int mid  = (sz * sz) / 2;
+	int nc	 = (t.x1 - t.x0) + sz - 1;	// columns under the tile
+
+	// column histograms; column c is image column CLIP(t.x0-half+c)
+	std::vector<ushort> fine  (nc * MXGRAY);
+	std::vector<ushort> coarse(nc * 16);
+	std::vector<const uchar*> colp(nc);
+	for(int c = 0; c < nc; c++)
+		colp[c] = src + CLIP(t.x0 - half + c, 0, w - 1);
+
+	// window histograms; luc[k]: columns [.., luc[k]) are in segment k
+	ushort Hc[16], Hf[MXGRAY];
+	int    luc[16];
+
+	for(int y = t.y0; y < t.y1; y++) {
+		// update column histograms for row y
+		if(y == t.y0) {
+			for(int i = 0; i < sz; i++) {
+				int yy = CLIP(y - half + i, 0, h - 1) * w;
+				for(int c = 0; c < nc; c++) {
+					int v = colp[c][yy];
+					fine  [c*MXGRAY + v]++;
+					coarse[c*16 + (v>>4)]++;
+				}
+			}
+		} else {
+			int yo = CLIP(y - 1 - half,	 0, h - 1) * w;
+			int yi = CLIP(y - 1 - half + sz, 0, h - 1) * w;
+			if(yo != yi) for(int c = 0; c < nc; c++) {
+				int vo = colp[c][yo];
+				int vi = colp[c][yi];
+				fine  [c*MXGRAY + vo]--;
+				coarse[c*16 + (vo>>4)]--;
+				fine  [c*MXGRAY + vi]++;
+				coarse[c*16 + (vi>>4)]++;
+			}
+		}
+
+		// coarse window histogram of the first sz columns
+		for(int k = 0; k < 16; k++) {
+			Hc [k] = 0;
+			luc[k] = 0;
+		}
+		for(int c = 0; c < sz; c++)
+			for(int k = 0; k < 16; k++) Hc[k] += coarse[c*16 + k];
+
+		uchar *out = dst + y * w + t.x0;
+		for(int i = 0; i < t.x1 - t.x0; i++) {
+			// slide window right: columns [i, i+sz)
+			if(i) {
+				const ushort *ca = &coarse[(i + sz - 1) * 16];
+				const ushort *cr = &coarse[(i - 1) * 16];
+				for(int k = 0; k < 16; k++) Hc[k] += ca[k] - cr[k];
+			}
+
+			// find coarse segment k holding the median
+			int k, sum = 0;
+			for(k = 0; sum + Hc[k] <= mid; k++) sum += Hc[k];
+
+			// bring fine segment k up to date with columns [i, i+sz)
+			ushort *seg = &Hf[k*16];
+			if(luc[k] <= i) {
+				for(int b = 0; b < 16; b++) seg[b] = 0;
+				for(int c = i; c < i + sz; c++) {
+					const ushort *f = &fine[c*MXGRAY + k*16];
+					for(int b = 0; b < 16; b++) seg[b] += f[b];
+				}
+			} else {
+				for(int c = luc[k]; c < i + sz; c++) {
+					const ushort *fa = &fine[ c	  *MXGRAY + k*16];
+					const ushort *fr = &fine[(c - sz)*MXGRAY + k*16];
+					for(int b = 0; b < 16; b++) seg[b] += fa[b] - fr[b];
+				}
+			}
+			luc[k] = i + sz;
+
+			// find median within segment
+			int b;
+			for(b = 0; sum + seg[b] <= mid; b++) sum += seg[b];
+			*out++ = k*16 + b;
+		}
+	}
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_median:
+//
+// Apply median filter of size sz x sz to I1, itrs times.
+// Borders are replicated.
+// Output is in I2.
+//
+// 3x3 and 5x5 windows use sorting networks in SIMD lanes; other sizes
+// use constant-time column histograms. Tiles of the output are filtered
+// in parallel on the ThreadPool. Histogram tiles are tall strips just
+// wide enough for their column histograms to stay in cache, since
+// starting a tile costs sz rows of histogram updates. Window counts are
+// 16-bit, which limits sz to 255. Multiple iterations of the networks
+// are fused per tile with HW_iterate().
+//
+void
+HW_median(ImagePtr I1, int sz, ImagePtr I2, int itrs)
+{
+	IP_copyImageHeader(I1, I2);
+	int w = I1->width ();
+	int h = I1->height();
+
+	// error check
+	if(sz <= 1 || itrs < 1) {
+		if(I1 != I2) IP_copyImage(I1, I2);
+		return;
+	}
+	if(sz > 255) {
+		fprintf(stderr, "HW_median: size must be less than 256\n");
+		return;
+	}
+
+	// iterations: the networks are fast enough to be bound by memory
+	// traffic, so they are fused per tile; the histogram method is bound
+	// by computation and runs one full pass per iteration
+	bool net = (sz == 3 || sz == 5);
+	if(itrs > 1 && net) {
+		HW_iterate(I1, itrs, sz / 2, [=](const uchar *src, int w, int h,
+						 const Tile &t, uchar *dst) {
+			HW_medianNet(src, w, h, sz, t, dst);
+		}, I2);
+		return;
+	}
+	if(itrs > 1) {
+		HW_median(I1, sz, I2);
+		for(int i=1; i<itrs; i++) HW_median(I2, sz, I2);
+		return;
+	}
+
+	// tiles read pixels owned by their neighbors: filter from a copy
+	ImagePtr Isrc;
+	if(I1 == I2) IP_copyImage(I1, Isrc);
+	else	     Isrc = I1;
+
+	Tiler tiler(w, h, sz / 2);
+	if(!net) {
+		// columns of 16-bit fine and coarse bins per tile
+		int cols = TILE_CACHE_BYTES / ((MXGRAY + 16) * sizeof(ushort));
+		int tw	 = MAX(cols - (sz - 1), 64);
+		int nx	 = (w + tw - 1) / tw;
+		int ny	 = MAX(4 * ThreadPool::instance().threads() / nx, 1);
+		tiler.setTileSize(tw, MAX((h + ny - 1) / ny, 4 * sz));
+	}
+
+	int type;
+	ChannelPtr<uchar> p1, p2;
+	for(int ch = 0; IP_getChannel(Isrc, ch, p1, type); ch++) {
+		IP_getChannel(I2, ch, p2, type);
+		const uchar *src = &p1[0];
+		uchar	    *dst = &p2[0];
+		tiler.run([=](const Tile &t) {
+			if(net) HW_medianNet  (src, w, h, sz, t, dst);
+			else	HW_medianHisto(src, w, h, sz, t, dst);
+		});
+	}
+}
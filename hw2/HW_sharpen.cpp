@@ -0,0 +1,45 @@
+#include "HW.h"
+#include "Tiler.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// HW_sharpen:
+//
+// Sharpen image I1 using a square box filter of dimension size.
+// Multiply the difference between I1 and the blurred image by factor
+// before adding it back to I1 to produce the output.
+// An even size is made odd, as in the sharpen shader.
+// Output is in I2.
+//
+void
+HW_sharpen(ImagePtr I1, int size, double factor, ImagePtr I2)
+{
+	int w = I1->width ();
+	int h = I1->height();
+	if(!(size % 2)) size++;
+
+	// blur into a separate image so that I1 may be the same as I2
+	ImagePtr Iblur;
+	HW_blur(I1, size, size, Iblur);
+	IP_copyImageHeader(I1, I2);
+
+	// point pass: out = in + factor * (in - blur), tiles in parallel
+	Tiler tiler(w, h);
+	int type;
+	ChannelPtr<uchar> p1, p2, pb;
+	for(int ch = 0; IP_getChannel(I1, ch, p1, type); ch++) {
+		IP_getChannel(I2,    ch, p2, type);
+		IP_getChannel(Iblur, ch, pb, type);
+		const uchar *src  = &p1[0];
+		const uchar *blur = &pb[0];
+		uchar	    *dst  = &p2[0];
+		tiler.run([=](const Tile &t) {
+			for(int y = t.y0; y < t.y1; y++) {
+				for(int x = t.x0; x < t.x1; x++) {
+					int    i    = y * w + x;
+					double diff = factor * (src[i] - blur[i]);
+					dst[i] = CLIP(src[i] + ROUND(diff), 0, MaxGray);
+				}
+			}
+		});
+	}
+}
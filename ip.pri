@@ -0,0 +1,45 @@
+# ======================================================================
+# ip.pri - IP library headers and libraries for each platform.
+# Shared by every target in qip.pro.
+# ======================================================================
+
+win32-msvc2013 {
+	Release:DESTDIR = release
+	Debug:DESTDIR = debug
+	INCLUDEPATH 	+= $$PWD/IP/win/header
+	LIBS 		+= -L$$PWD/IP/win/lib
+	CONFIG(release, debug|release) {
+		LIBS += -lIP
+	} else {
+		LIBS += -lIP_d
+	}
+	QMAKE_CXXFLAGS  += /MP /Zi
+}
+
+
+win32-msvc2015 {
+	Release:DESTDIR = release
+	Debug:DESTDIR = debug
+	INCLUDEPATH 	+= $$PWD/IP/win/header
+	LIBS 		+= -L$$PWD/IP/win/lib
+	CONFIG(release, debug|release) {
+		LIBS += -lIP
+	} else {
+		LIBS += -lIP_d
+	}
+	QMAKE_CXXFLAGS  += /MP /Zi
+}
+
+macx{
+	QMAKE_MACOSX_DEPLOYMENT_TARGET = 10.9
+	INCLUDEPATH += $$PWD/IP/mac/header
+	LIBS        += -L$$PWD/IP/mac/lib
+	LIBS        += -lIP_d
+}
+
+unix:!macx {
+	CONFIG += C++11
+	INCLUDEPATH += $$PWD/IP/linux/header
+	LIBS        += -L$$PWD/IP/linux/lib
+	LIBS        += -lIP_d
+}
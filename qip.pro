@@ -1,97 +1,24 @@
-TEMPLATE    = app
-TARGET      = qip
-QT 	   += widgets printsupport opengl
-RESOURCES   = qip.qrc
-CONFIG     += qt debug_and_release
-
-
-Release:OBJECTS_DIR = release/.obj
-Release:MOC_DIR     = release/.moc
-Debug:OBJECTS_DIR   = debug/.obj
-Debug:MOC_DIR       = debug/.moc
-
-
-win32-msvc2013 {
-	Release:DESTDIR = release
-	Debug:DESTDIR = debug
-	INCLUDEPATH 	+= ./IP/win/header
-	LIBS 		+= -L./IP/win/lib
-	CONFIG(release, debug|release) {
-		LIBS += -lIP
-	} else {
-		LIBS += -lIP_d
-	}
-	LIBS 		+= -lopengl32
-	QMAKE_CXXFLAGS  += /MP /Zi
-}
-
-
-win32-msvc2015 {
-	Release:DESTDIR = release
-	Debug:DESTDIR = debug
-	INCLUDEPATH 	+= ./IP/win/header
-	LIBS 		+= -L./IP/win/lib
-	CONFIG(release, debug|release) {
-		LIBS += -lIP
-	} else {
-		LIBS += -lIP_d
-	}
-	LIBS 		+= -lopengl32
-	QMAKE_CXXFLAGS  += /MP /Zi
-}
-
-macx{
-	QMAKE_MACOSX_DEPLOYMENT_TARGET = 10.9
-	INCLUDEPATH += ./IP/mac/header
-	LIBS        += -L./IP/mac/lib
-	LIBS        += -lIP_d
-}
-
-unix:!macx {
-	CONFIG += C++11
-	INCLUDEPATH += ./IP/linux/header
-	LIBS        += -L./IP/linux/lib
-	LIBS        += -lIP_d
-}
-
-
-# Input
-HEADERS +=	MainWindow.h	\
-		ImageFilter.h	\
-		qcustomplot.h	\
-		Dummy.h		\
-		Threshold.h	\
-		Clip.h		\
-		Quantize.h	\
-		Gamma.h		\
-		Contrast.h	\
-		HistoStretch.h	\
-		HistoMatch.h	\
-		ErrDiffusion.h	\
-		Blur.h		\
-		Sharpen.h	\
-		Median.h	\
-		GLWidget.h	\
-		Convolve.h	\
-		Correlation.h
-
-
-SOURCES +=	main.cpp	\
-		MainWindow.cpp 	\
-		ImageFilter.cpp	\
-		qcustomplot.cpp	\
-		Dummy.cpp	\
-		Threshold.cpp	\
-		Clip.cpp	\
-		Quantize.cpp	\
-		Gamma.cpp	\
-		Contrast.cpp	\
-		HistoStretch.cpp\
-		HistoMatch.cpp	\
-		ErrDiffusion.cpp\
-		Blur.cpp	\
-		Sharpen.cpp	\
-		Median.cpp	\
-		GLWidget.cpp	\
-		Convolve.cpp	\
-		Correlation.cpp
+# ======================================================================
+# qip.pro - Top-level project.
+#
+# qipfilters: headless library of HW_* kernels (IP library only)
+# qipapp    : qip GUI (widgets + OpenGL), links qipfilters
+# qipbatch  : qip-batch command-line pipeline runner, links qipfilters
+# qipbench  : qip-bench wall-clock benchmark suite, links qipfilters
+#
+# All platforms build through qmake. On Windows, run qmake and nmake (or
+# jom) from a Visual Studio prompt, or generate a solution with
+#	qmake -tp vc -r qip.pro
+# ======================================================================
+
+TEMPLATE = subdirs
+
+SUBDIRS  = qipfilters qipapp qipbatch qipbench
+
+qipfilters.file	= qipfilters.pro
+qipapp.file	= qipapp.pro
+qipapp.depends	= qipfilters
+qipbatch.file	= qipbatch.pro
+qipbatch.depends = qipfilters
+qipbench.file	= qipbench.pro
+qipbench.depends = qipfilters
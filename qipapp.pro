@@ -0,0 +1,61 @@
+# ======================================================================
+# qipapp.pro - qip GUI. Kernels come from the qipfilters library.
+# ======================================================================
+
+TEMPLATE    = app
+TARGET      = qip
+QT 	   += widgets printsupport opengl
+RESOURCES   = qip.qrc
+CONFIG     += qt debug_and_release
+
+
+Release:OBJECTS_DIR = release/.obj
+Release:MOC_DIR     = release/.moc
+Debug:OBJECTS_DIR   = debug/.obj
+Debug:MOC_DIR       = debug/.moc
+
+
+include(qipfilters.pri)
+win32: LIBS += -lopengl32
+
+
+# Input
+HEADERS +=	MainWindow.h	\
+		ImageFilter.h	\
+		qcustomplot.h	\
+		Dummy.h		\
+		Threshold.h	\
+		Clip.h		\
+		Quantize.h	\
+		Gamma.h		\
+		Contrast.h	\
+		HistoStretch.h	\
+		HistoMatch.h	\
+		ErrDiffusion.h	\
+		Blur.h		\
+		Sharpen.h	\
+		Median.h	\
+		GLWidget.h	\
+		Convolve.h	\
+		Correlation.h
+
+
+SOURCES +=	main.cpp	\
+		MainWindow.cpp 	\
+		ImageFilter.cpp	\
+		qcustomplot.cpp	\
+		Dummy.cpp	\
+		Threshold.cpp	\
+		Clip.cpp	\
+		Quantize.cpp	\
+		Gamma.cpp	\
+		Contrast.cpp	\
+		HistoStretch.cpp\
+		HistoMatch.cpp	\
+		ErrDiffusion.cpp\
+		Blur.cpp	\
+		Sharpen.cpp	\
+		Median.cpp	\
+		GLWidget.cpp	\
+		Convolve.cpp	\
+		Correlation.cpp
@@ -0,0 +1,252 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// qipbatch.cpp - Apply a filter pipeline to every image in a directory.
+//
+// Usage: qip-batch [-j threads] [-g] [-o outdir] "spec" indir
+//	-j	number of threads (default: all cores)
+//	-g	convert input to grayscale before filtering
+//	-o	output directory (default: no output is saved)
+//	spec	pipeline, e.g. "threshold:128 | blur:7x7 | convolve:k.AF"
+//
+// Every file becomes a read -> filter -> save chain in a TaskGraph on
+// the ThreadPool. Files are processed concurrently, and the filters
+// themselves run tiles on the same pool, so small batches of large
+// images still use all cores. At most 2 files per thread are in flight.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <QDir>
+#include <QFileInfo>
+#include <chrono>
+#include "Pipeline.h"
+#include "TaskGraph.h"
+
+typedef std::chrono::steady_clock Clock;
+
+// per-file state and statistics; merged after the task graph finishes
+struct BatchFile {
+	QFileInfo info;			// input file
+	ImagePtr  I1, I2;		// input and output of the pipeline
+	std::vector<double> secs;	// time spent in each pipeline stage
+	double	readSecs;		// time spent in IP_readImage
+	double	saveSecs;		// time spent in IP_saveImage
+	double	pixels;			// pixels filtered
+	bool	ok;			// image was read and filtered
+	int	errors;			// 1 if file could not be read/saved
+};
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// elapsed:
+//
+// Seconds since t.
+//
+static double
+elapsed(Clock::time_point t)
+{
+	return std::chrono::duration<double>(Clock::now() - t).count();
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// readFile:
+//
+// Read file f->info and cast it to BW or RGB in f->I1.
+//
+static void
+readFile(BatchFile *f, bool gray)
+{
+	Clock::time_point t = Clock::now();
+	ImagePtr Iin = IP_readImage(qPrintable(f->info.filePath()));
+	f->readSecs = elapsed(t);
+	if(Iin.isNull()) {
+		fprintf(stderr, "qip-batch: can't read %s\n", qPrintable(f->info.filePath()));
+		f->errors = 1;
+		return;
+	}
+	IP_castImage(Iin, gray ? BW_IMAGE : RGB_IMAGE, f->I1);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// filterFile:
+//
+// Apply pipeline to f->I1. Output is in f->I2.
+// The pipeline is parsed once and shared by all files: its stages,
+// including the analyzed convolution kernel, are only read, and no
+// ImagePtr (whose reference count is not thread-safe) of it is copied.
+//
+static void
+filterFile(BatchFile *f, const Pipeline *pipeline)
+{
+	if(f->errors) return;
+
+	f->secs.assign(pipeline->stages(), 0.);
+	pipeline->apply(f->I1, f->I2, &f->secs[0]);
+	f->pixels = (double) f->I1->width() * f->I1->height();
+	f->ok	  = true;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// saveFile:
+//
+// Save f->I2 into outdir (if any) and release the file's images.
+//
+static void
+saveFile(BatchFile *f, const QString *outdir)
+{
+	if(f->ok && !outdir->isEmpty()) {
+		QString out = *outdir + "/" + f->info.fileName();
+		Clock::time_point t = Clock::now();
+		if(!IP_saveImage(f->I2, qPrintable(out), qPrintable(f->info.suffix().toUpper()))) {
+			fprintf(stderr, "qip-batch: can't save %s\n", qPrintable(out));
+			f->errors = 1;
+		}
+		f->saveSecs = elapsed(t);
+	}
+	f->I1 = NEWIMAGE;
+	f->I2 = NEWIMAGE;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// report:
+//
+// Print one line of the throughput table. Stage time secs is summed
+// over all files and threads; total is the sum over all stages. The
+// stage is charged its share of the wall-clock time of the whole run,
+// and its rate is the number of images per second of that share.
+//
+static void
+report(const char *name, double secs, double total, double wall, int images)
+{
+	double share = total > 0 ? secs / total : 0.;
+	double t     = share * wall;
+	printf("%-40s %10.3f %9.1f%% %10.3f %10.1f\n", name, secs,
+	       100 * share, t, t > 0 ? images / t : 0.);
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// usage:
+//
+// Print usage message.
+//
+static int
+usage()
+{
+	fprintf(stderr, "usage: qip-batch [-j threads] [-g] [-o outdir] \"spec\" indir\n");
+	fprintf(stderr, "  stages: threshold:thr clip:t1,t2 quantize:levels[,dither[,seed]]\n");
+	fprintf(stderr, "          gamma:g contrast:brightness,contrast histostretch:t1,t2\n");
+	fprintf(stderr, "          blur:WxH convolve:kernel.AF\n");
+	return 1;
+}
+
+
+
+int main(int argc, char **argv)
+{
+	int	nthreads = 0;
+	bool	gray	 = false;
+	QString	outdir;
+
+	// parse options
+	int i;
+	for(i=1; i<argc && argv[i][0] == '-'; i++) {
+		if(!strcmp(argv[i], "-j") && i+1 < argc)
+			nthreads = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-o") && i+1 < argc)
+			outdir = argv[++i];
+		else if(!strcmp(argv[i], "-g"))
+			gray = true;
+		else	return usage();
+	}
+	if(argc - i != 2) return usage();
+	const char *spec  = argv[i];
+	QDir	    indir(argv[i+1]);
+	if(nthreads > 0) ThreadPool::instance().configure(nthreads);
+	nthreads = ThreadPool::instance().threads();
+
+	// parse spec once: errors are reported a single time and kernels
+	// are read and analyzed once for all files
+	Pipeline pipeline;
+	if(!pipeline.parse(spec)) return 1;
+
+	// collect input files
+	QStringList filters;
+	filters << "*.jpg" << "*.png" << "*.ppm" << "*.pgm" << "*.bmp";
+	std::vector<BatchFile> files;
+	foreach(const QFileInfo &f, indir.entryInfoList(filters, QDir::Files, QDir::Name)) {
+		BatchFile file;
+		file.info     = f;
+		file.readSecs = file.saveSecs = file.pixels = 0;
+		file.ok	      = false;
+		file.errors   = 0;
+		files.push_back(file);
+	}
+	if(files.empty()) {
+		fprintf(stderr, "qip-batch: no images in %s\n", argv[i+1]);
+		return 1;
+	}
+	if(!outdir.isEmpty()) QDir().mkpath(outdir);
+
+	// build task graph: read -> filter -> save for every file; a file is
+	// read only after the file 2*nthreads before it is saved, which
+	// bounds the number of images held in memory
+	TaskGraph graph;
+	const Pipeline *pl = &pipeline;
+	int inflight = 2 * nthreads;
+	std::vector<int> save(files.size());
+	for(size_t k=0; k<files.size(); k++) {
+		BatchFile *f = &files[k];
+		int r = graph.add([=]() { readFile  (f, gray);    });
+		int p = graph.add([=]() { filterFile(f, pl);      });
+		save[k] = graph.add([=]() { saveFile (f, &outdir); });
+		graph.depend(p, r);
+		graph.depend(save[k], p);
+		if((int) k >= inflight) graph.depend(r, save[k-inflight]);
+	}
+	Clock::time_point t = Clock::now();
+	graph.run();
+	double wall = elapsed(t);
+
+	// merge statistics
+	int	n = pipeline.stages();
+	std::vector<double> secs(n, 0.);
+	double	readSecs = 0, saveSecs = 0, pixels = 0;
+	int	images = 0, errors = 0;
+	for(size_t k=0; k<files.size(); k++) {
+		for(int s=0; s<n && s<(int) files[k].secs.size(); s++)
+			secs[s] += files[k].secs[s];
+		readSecs += files[k].readSecs;
+		saveSecs += files[k].saveSecs;
+		pixels	 += files[k].pixels;
+		errors	 += files[k].errors;
+		images	 += files[k].ok;
+	}
+
+	// print per-stage share of the run
+	double total = readSecs + saveSecs;
+	for(int s=0; s<n; s++) total += secs[s];
+	printf("%-40s %10s %10s %10s %10s\n", "stage", "time(s)", "share", "wall(s)", "img/s");
+	report("read", readSecs, total, wall, images);
+	for(int s=0; s<n; s++)
+		report(pipeline.stageSpec(s), secs[s], total, wall, images);
+	if(!outdir.isEmpty())
+		report("save", saveSecs, total, wall, images);
+	printf("\n%d images (%d errors) in %.3f s with %d threads: %.1f img/s, %.1f MPix/s\n",
+	       images, errors, wall, nthreads,
+	       images / wall, pixels / wall * 1e-6);
+
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,18 @@
+# ======================================================================
+# qipbatch.pro - qip-batch: command-line filter pipeline over a directory.
+# ======================================================================
+
+TEMPLATE    = app
+TARGET      = qip-batch
+QT         += widgets
+CONFIG     += console thread debug_and_release
+CONFIG     -= app_bundle
+
+Release:OBJECTS_DIR = release/.obj/qipbatch
+Debug:OBJECTS_DIR   = debug/.obj/qipbatch
+
+include(qipfilters.pri)
+
+
+# Input
+SOURCES +=	qipbatch.cpp
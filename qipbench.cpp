@@ -0,0 +1,289 @@
+// ======================================================================
+// IMPROC: Image Processing Software Package
+// Copyright (C) 2016 by George Wolberg
+//
+// qipbench.cpp - Wall-clock benchmark of the HW_* kernels.
+//
+// Usage: qip-bench [options]
+//	-f names	comma-separated filters (default: all)
+//	-s sizes	comma-separated synthetic sizes (default: 512,1024,2048,4096,8192)
+//	-i dir		image corpus directory (default: images; "" to skip)
+//	-k file		convolution kernel (default: kernels/kernelBlur7x7.AF)
+//	-w n		warmup iterations (default: 2)
+//	-n n		max timed iterations (default: 50)
+//	-t secs		time budget per case (default: 2)
+//	-o file		JSON output file (default: stdout)
+//	-j n		threads in the ThreadPool (default: all cores)
+//
+// Every case is timed with a steady wall clock, one sample per call.
+// Reported are p50/p95/p99/mean latency and MPix/s at the median.
+//
+// Written by: George Wolberg, 2016
+// ======================================================================
+
+#include <QDir>
+#include <QFileInfo>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include "HW.h"
+#include "ThreadPool.h"
+
+typedef std::chrono::steady_clock Clock;
+
+// inputs shared by the filter wrappers
+static ImagePtr g_kernel;	// convolution kernel
+static ImagePtr g_lut;		// target histogram for histoMatch
+static ImagePtr g_template;	// correlation template
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Filter wrappers: run each kernel with the default qip panel settings.
+//
+static void benchThreshold   (ImagePtr I1, ImagePtr I2) { HW_threshold	 (I1, MXGRAY>>1, I2); }
+static void benchClip	     (ImagePtr I1, ImagePtr I2) { HW_clip	 (I1, 64, 192, I2); }
+static void benchQuantize    (ImagePtr I1, ImagePtr I2) { HW_quantize	 (I1, 16, false, I2); }
+static void benchQuantizeD   (ImagePtr I1, ImagePtr I2) { HW_quantize	 (I1, 16, true, I2); }
+static void benchGamma	     (ImagePtr I1, ImagePtr I2) { HW_gammaCorrect(I1, 2.2, I2); }
+static void benchContrast    (ImagePtr I1, ImagePtr I2) { HW_contrast	 (I1, 10., 1.5, I2); }
+static void benchHistoStretch(ImagePtr I1, ImagePtr I2) { HW_histoStretch(I1, 32, 224, I2); }
+static void benchHistoMatch  (ImagePtr I1, ImagePtr I2) { HW_histoMatch	 (I1, g_lut, I2); }
+static void benchBlur	     (ImagePtr I1, ImagePtr I2) { HW_blur	 (I1, 7, 7, I2); }
+static void benchSharpen     (ImagePtr I1, ImagePtr I2) { HW_sharpen	 (I1, 3, 1., I2); }
+static void benchMedian	     (ImagePtr I1, ImagePtr I2) { HW_median	 (I1, 3, I2); }
+static void benchConvolve    (ImagePtr I1, ImagePtr I2) { HW_convolve	 (I1, g_kernel, I2); }
+static void benchCorrelation (ImagePtr I1, ImagePtr)
+{
+	int xx, yy;
+	HW_correlation(I1, g_template, CROSS_CORR, 0, xx, yy);
+}
+
+struct BenchFilter {
+	const char *name;			// filter name used with -f
+	void	  (*run)(ImagePtr, ImagePtr);	// filter wrapper
+};
+
+static BenchFilter Filters[] = {
+	{ "threshold",	  benchThreshold },
+	{ "clip",	  benchClip },
+	{ "quantize",	  benchQuantize },
+	{ "quantize_dither", benchQuantizeD },
+	{ "gamma",	  benchGamma },
+	{ "contrast",	  benchContrast },
+	{ "histostretch", benchHistoStretch },
+	{ "histomatch",	  benchHistoMatch },
+	{ "blur",	  benchBlur },
+	{ "sharpen",	  benchSharpen },
+	{ "median",	  benchMedian },
+	{ "convolve",	  benchConvolve },
+	{ "correlation",  benchCorrelation },
+};
+static const int NumFilters = sizeof(Filters) / sizeof(Filters[0]);
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// synthetic:
+//
+// Deterministic RGB test image of size w x h: smooth gradients plus
+// pseudo-random texture so that neither LUTs nor branches are trivial.
+//
+static ImagePtr
+synthetic(int w, int h)
+{
+	ImagePtr I = IP_allocImage(w, h, RGB_TYPE);
+	I->setImageType(RGB_IMAGE);
+
+	unsigned int seed = 12345;
+	int type;
+	ChannelPtr<uchar> p;
+	for(int ch = 0; IP_getChannel(I, ch, p, type); ch++) {
+		for(int y=0; y<h; y++) {
+			for(int x=0; x<w; x++) {
+				seed = seed * 1664525u + 1013904223u;
+				int v = (x * MXGRAY / w + y * MXGRAY / h) / 2;
+				v += (int) (seed >> 28) - 8 + ch * 16;
+				*p++ = CLIP(v, 0, MaxGray);
+			}
+		}
+	}
+	return I;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// percentile:
+//
+// Nearest-rank percentile q (0..100) of sorted samples.
+//
+static double
+percentile(const std::vector<double> &sorted, double q)
+{
+	int n = (int) sorted.size();
+	int k = (int) ceil(q / 100. * n) - 1;
+	return sorted[CLIP(k, 0, n-1)];
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// runCase:
+//
+// Time filter f on I1: warmup untimed calls, then up to iters timed
+// calls or until budget seconds have elapsed. Emit one JSON record.
+//
+static void
+runCase(FILE *json, bool &first, const BenchFilter &f, const char *image,
+	ImagePtr I1, int warmup, int iters, double budget)
+{
+	ImagePtr I2;
+	for(int i=0; i<warmup; i++) f.run(I1, I2);
+
+	std::vector<double> ms;
+	Clock::time_point start = Clock::now();
+	for(int i=0; i<iters; i++) {
+		Clock::time_point t = Clock::now();
+		f.run(I1, I2);
+		Clock::time_point t2 = Clock::now();
+		ms.push_back(std::chrono::duration<double, std::milli>(t2 - t).count());
+		if(std::chrono::duration<double>(t2 - start).count() > budget) break;
+	}
+	std::sort(ms.begin(), ms.end());
+
+	double mean = 0;
+	for(size_t i=0; i<ms.size(); i++) mean += ms[i];
+	mean /= ms.size();
+
+	int	w    = I1->width ();
+	int	h    = I1->height();
+	double	p50  = percentile(ms, 50);
+	double	mpix = (double) w * h / (p50 * 1e3);
+
+	fprintf(stderr, "%-16s %-24s %5dx%-5d %4d  p50 %9.3f  p95 %9.3f  p99 %9.3f ms  %8.1f MPix/s\n",
+		f.name, image, w, h, (int) ms.size(), p50,
+		percentile(ms, 95), percentile(ms, 99), mpix);
+
+	fprintf(json, "%s\n    {\"filter\": \"%s\", \"image\": \"%s\", \"width\": %d, \"height\": %d, "
+		"\"iterations\": %d, \"p50_ms\": %.4f, \"p95_ms\": %.4f, \"p99_ms\": %.4f, "
+		"\"mean_ms\": %.4f, \"mpix_s\": %.2f}",
+		first ? "" : ",", f.name, image, w, h, (int) ms.size(),
+		p50, percentile(ms, 95), percentile(ms, 99), mean, mpix);
+	fflush(json);
+	first = false;
+}
+
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// usage:
+//
+// Print usage message.
+//
+static int
+usage()
+{
+	fprintf(stderr, "usage: qip-bench [-f filters] [-s sizes] [-i dir] [-k kernel]"
+			" [-w warmup] [-n iters] [-t secs] [-o out.json] [-j threads]\n");
+	fprintf(stderr, "  filters:");
+	for(int i=0; i<NumFilters; i++) fprintf(stderr, " %s", Filters[i].name);
+	fprintf(stderr, "\n");
+	return 1;
+}
+
+
+
+int main(int argc, char **argv)
+{
+	QString	filters	= "";
+	QString	sizes	= "512,1024,2048,4096,8192";
+	QString	corpus	= "images";
+	QString	kernel	= "kernels/kernelBlur7x7.AF";
+	QString	out	= "";
+	int	warmup	= 2;
+	int	iters	= 50;
+	double	budget	= 2.;
+	int	threads	= 0;
+
+	// parse options
+	for(int i=1; i<argc; i++) {
+		if(i+1 >= argc) return usage();
+		if     (!strcmp(argv[i], "-f")) filters = argv[++i];
+		else if(!strcmp(argv[i], "-s")) sizes	= argv[++i];
+		else if(!strcmp(argv[i], "-i")) corpus	= argv[++i];
+		else if(!strcmp(argv[i], "-k")) kernel	= argv[++i];
+		else if(!strcmp(argv[i], "-o")) out	= argv[++i];
+		else if(!strcmp(argv[i], "-w")) warmup	= atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-n")) iters	= MAX(1, atoi(argv[++i]));
+		else if(!strcmp(argv[i], "-t")) budget	= atof(argv[++i]);
+		else if(!strcmp(argv[i], "-j")) threads	= atoi(argv[++i]);
+		else return usage();
+	}
+	if(threads > 0) ThreadPool::instance().configure(threads);
+
+	// shared filter inputs
+	g_kernel = IP_readImage(qPrintable(kernel));
+	if(g_kernel.isNull()) {
+		fprintf(stderr, "qip-bench: can't read kernel %s\n", qPrintable(kernel));
+		return 1;
+	}
+	g_lut = IP_allocImage(MXGRAY, 1, INTCH_TYPE);
+	ChannelPtr<int> lut = g_lut[0];
+	for(int i=0; i<MXGRAY; i++) lut[i] = 1;		// flat target histogram
+	ImagePtr Itmpl = synthetic(32, 32);
+	g_template = IP_allocImage(32, 32, BW_TYPE);
+	IP_castImage(Itmpl, BW_IMAGE, g_template);
+
+	// select filters
+	QStringList names = filters.split(',', QString::SkipEmptyParts);
+	std::vector<const BenchFilter*> selected;
+	for(int i=0; i<NumFilters; i++)
+		if(names.isEmpty() || names.contains(Filters[i].name))
+			selected.push_back(&Filters[i]);
+	if(selected.empty()) return usage();
+
+	// collect corpus images
+	std::vector<ImagePtr>	 images;
+	std::vector<std::string> labels;
+	if(!corpus.isEmpty()) {
+		QStringList nf;
+		nf << "*.jpg" << "*.png" << "*.ppm" << "*.pgm" << "*.bmp";
+		foreach(const QFileInfo &f, QDir(corpus).entryInfoList(nf, QDir::Files, QDir::Name)) {
+			ImagePtr Iin = IP_readImage(qPrintable(f.filePath()));
+			if(Iin.isNull()) continue;
+			ImagePtr I;
+			IP_castImage(Iin, RGB_IMAGE, I);
+			images.push_back(I);
+			labels.push_back(qPrintable(f.fileName()));
+		}
+	}
+
+	FILE *json = stdout;
+	if(!out.isEmpty() && !(json = fopen(qPrintable(out), "w"))) {
+		fprintf(stderr, "qip-bench: can't write %s\n", qPrintable(out));
+		return 1;
+	}
+	fprintf(json, "{\n  \"warmup\": %d, \"max_iterations\": %d, \"budget_s\": %g, \"threads\": %d,\n  \"results\": [",
+		warmup, iters, budget, ThreadPool::instance().threads());
+
+	bool first = true;
+	for(size_t k=0; k<selected.size(); k++) {
+		const BenchFilter &f = *selected[k];
+
+		// corpus images
+		for(size_t i=0; i<images.size(); i++)
+			runCase(json, first, f, labels[i].c_str(), images[i], warmup, iters, budget);
+
+		// synthetic sizes
+		foreach(const QString &s, sizes.split(',', QString::SkipEmptyParts)) {
+			int n = s.toInt();
+			if(n <= 0) continue;
+			runCase(json, first, f, "synthetic", synthetic(n, n), warmup, iters, budget);
+		}
+	}
+	fprintf(json, "\n  ]\n}\n");
+	if(json != stdout) fclose(json);
+
+	return 0;
+}
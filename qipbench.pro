@@ -0,0 +1,18 @@
+# ======================================================================
+# qipbench.pro - qip-bench: wall-clock benchmark of the HW_* kernels.
+# ======================================================================
+
+TEMPLATE    = app
+TARGET      = qip-bench
+QT         += widgets
+CONFIG     += console thread debug_and_release
+CONFIG     -= app_bundle
+
+Release:OBJECTS_DIR = release/.obj/qipbench
+Debug:OBJECTS_DIR   = debug/.obj/qipbench
+
+include(qipfilters.pri)
+
+
+# Input
+SOURCES +=	qipbench.cpp
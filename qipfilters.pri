@@ -0,0 +1,23 @@
+# ======================================================================
+# qipfilters.pri - Link a target against the headless qipfilters library.
+# ======================================================================
+
+INCLUDEPATH += $$PWD
+
+win32 {
+	CONFIG(release, debug|release) {
+		LIBS += -L$$OUT_PWD/release
+	} else {
+		LIBS += -L$$OUT_PWD/debug
+	}
+} else {
+	LIBS		+= -L$$OUT_PWD
+	PRE_TARGETDEPS	+= $$OUT_PWD/libqipfilters.a
+}
+LIBS += -lqipfilters
+
+# kernels run on the ThreadPool
+CONFIG += thread
+
+# IP library must follow qipfilters on the link line
+include(ip.pri)
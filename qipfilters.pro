@@ -0,0 +1,53 @@
+# ======================================================================
+# qipfilters.pro - Headless library of the HW_* image processing kernels.
+#
+# Builds only against the IP library: no MainWindow, no ImageFilter
+# widgets, no GLWidget. IP.h pulls in <QtWidgets> for its typedefs, so
+# the widgets headers are needed at compile time, but nothing in this
+# library requires a QApplication, an event loop, or a GL context.
+# ======================================================================
+
+TEMPLATE    = lib
+TARGET      = qipfilters
+QT         += widgets
+CONFIG     += staticlib thread debug_and_release
+
+Release:OBJECTS_DIR = release/.obj/qipfilters
+Debug:OBJECTS_DIR   = debug/.obj/qipfilters
+
+include(ip.pri)
+
+
+# Input
+HEADERS +=	HW.h		\
+		FFT.h		\
+		IntegralImage.h	\
+		Pipeline.h	\
+		Simd.h		\
+		ThreadPool.h	\
+		TaskGraph.h	\
+		Tiler.h
+
+
+SOURCES +=	hw1/HW_lut.cpp		\
+		hw1/HW_threshold.cpp	\
+		hw1/HW_clip.cpp		\
+		hw1/HW_quantize.cpp	\
+		hw1/HW_gamma.cpp	\
+		hw1/HW_contrast.cpp	\
+		hw1/HW_histogram.cpp	\
+		hw1/HW_histoStretch.cpp	\
+		hw1/HW_histoMatch.cpp	\
+		hw2/HW_blur.cpp		\
+		hw2/HW_sharpen.cpp	\
+		hw2/HW_median.cpp	\
+		hw2/HW_iterate.cpp	\
+		hw2/HW_convolve.cpp	\
+		hw2/HW_correlation.cpp	\
+		FFT.cpp			\
+		IntegralImage.cpp	\
+		Pipeline.cpp		\
+		Simd.cpp		\
+		ThreadPool.cpp		\
+		TaskGraph.cpp		\
+		Tiler.cpp